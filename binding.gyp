@@ -14,33 +14,44 @@
         "src/node/node_init.cpp",
         "src/node/platform.cpp",
 
+        "src/base64.hpp",
         "src/concurrent_deque.hpp",
         "src/event_loop_dispatcher.hpp",
+        "src/full_text_index.hpp",
+        "src/iso8601.hpp",
+        "src/js_aggregate.hpp",
         "src/js_class.hpp",
         "src/js_collection.hpp",
         "src/js_list.hpp",
         "src/js_object_accessor.hpp",
+        "src/js_object_serializer.hpp",
         "src/js_observable.hpp",
         "src/js_realm.hpp",
         "src/js_realm_object.hpp",
         "src/js_results.hpp",
         "src/js_schema.hpp",
         "src/js_sync.hpp",
+        "src/js_thread_safe_reference.hpp",
         "src/js_types.hpp",
         "src/js_util.hpp",
+        "src/list_diff.hpp",
         "src/node/node_class.hpp",
         "src/node/node_context.hpp",
         "src/node/node_exception.hpp",
         "src/node/node_function.hpp",
         "src/node/node_init.hpp",
+        "src/node/node_isolate_data.hpp",
         "src/node/node_object.hpp",
         "src/node/node_protected.hpp",
         "src/node/node_return_value.hpp",
         "src/node/node_string.hpp",
         "src/node/node_types.hpp",
         "src/node/node_value.hpp",
+        "src/parallel_query.hpp",
         "src/platform.hpp",
+        "src/primitive_query_builder.hpp",
         "src/rpc.hpp",
+        "src/thread_pool.hpp",
       ],
       "include_dirs": [
         "src"
@@ -72,11 +72,26 @@ class Collection {
      * @throws {Error} If the query or any other argument passed into this method is invalid.
      * @returns {Realm.Results<T>} filtered according to the provided query.
      *
-     * This is currently only supported for collections of Realm Objects.
+     * Collections of other types are filtered on the values themselves, which the
+     * query refers to as `self`. Comparisons must then be between `self` and a value
+     * or placeholder, and dates can only be given as placeholders.
+     *
+     * When all of the objects of a type are filtered, an object `{parallel: n}` can be passed
+     * after the placeholder arguments to evaluate the query on up to `n` threads, each over a
+     * range of the objects and at the version the Realm is at. The objects are returned as a
+     * {@link Realm.Results#snapshot snapshot}, which doesn't update as the Realm changes. Inside
+     * a write transaction the query is evaluated on the calling thread instead. Each thread opens
+     * the Realm once for the query and closes it before `filtered()` returns.
      *
      * See {@tutorial query-language} for details about the query language.
      * @example
      * let merlots = wines.filtered('variety == "Merlot" && vintage <= $0', maxYear);
+     * @example
+     * // Filter a list of numbers
+     * let highScores = player.scores.filtered('self >= $0', 100);
+     * @example
+     * // Evaluate the query on 8 threads (since 2.3.0)
+     * let large = realm.objects('Payment').filtered('amount > $0', 1000, {parallel: 8});
      */
     filtered(query, ...arg) {}
 
@@ -117,6 +132,42 @@ class Collection {
      */
     sorted(descriptor, reverse) {}
 
+    /**
+     * Returns new _Results_ that contain only the first object of each set of
+     * objects with the same values for the given properties. The
+     * deduplication is done natively, and the returned _Results_ are live
+     * like those of {@link Realm.Collection#filtered filtered()} and
+     * {@link Realm.Collection#sorted sorted()}, which they can be combined with.
+     *
+     * Collections of other types are deduplicated on the values themselves, and
+     * so no property names should be supplied.
+     *
+     * @example
+     * // One wine per vineyard and year, most expensive first
+     * wines.sorted('price', true).distinct(['vineyard', 'year'])
+     *
+     * @param {string|string[]} [properties] - The property name(s), which may be
+     *   key paths through links, whose values must be unique.
+     * @throws {Error} If a specified property does not exist.
+     * @returns {Realm.Results<T>} without the duplicate objects.
+     * @since 2.3.0
+     */
+    distinct(properties) {}
+
+    /**
+     * Converts the objects in the collection, and the objects they link to, into an array of
+     * plain JavaScript objects in a single native pass, as described for
+     * {@link Realm.Object#toJSON Realm.Object.toJSON()}. Objects reached from several
+     * objects in the collection are converted once. This is also used by `JSON.stringify()`.
+     *
+     * Collections of other types are converted into arrays of their values.
+     * @param {Object} [options] - The same options as for {@link Realm.Object#toJSON Realm.Object.toJSON()}.
+     * @throws {Error} If a key path in `include` is not a path of links.
+     * @returns {Array} the converted values.
+     * @since 2.3.0
+     */
+    toJSON(options) {}
+
     /**
      * Create a frozen snapshot of the collection.
      *
@@ -296,6 +347,58 @@ class Collection {
      */
     avg(property) {}
 
+    /**
+     * Computes several aggregates at once, in a single pass over the objects
+     * in the collection. This is faster than calling {@link Realm.Collection#min min()},
+     * {@link Realm.Collection#sum sum()}, etc. one after the other when more
+     * than one value is needed.
+     *
+     * The result has the same shape as the description, with the value of each
+     * aggregate keyed by property name:
+     * ```js
+     * let stats = orders.aggregate({count: true, sum: ['total', 'tax'], avg: 'total'});
+     * // stats = {count: 12, sum: {total: 340.5, tax: 34.05}, avg: {total: 28.375}}
+     * ```
+     *
+     * The same rules as for the individual methods apply: `null` values are
+     * ignored, `min`, `max` and `avg` are `undefined` if there are no values,
+     * and date properties only support `min` and `max`.
+     * @param {Object} aggregates - Which aggregates to compute.
+     * @param {boolean} [aggregates.count] - Whether to include the number of objects.
+     * @param {string|string[]} [aggregates.min] - The properties to take the minimum of.
+     * @param {string|string[]} [aggregates.max] - The properties to take the maximum of.
+     * @param {string|string[]} [aggregates.sum] - The properties to take the sum of.
+     * @param {string|string[]} [aggregates.avg] - The properties to take the average of.
+     * @throws {Error} If a property doesn't exist or doesn't support the aggregate,
+     *   or if this is a collection of primitive values.
+     * @returns {Object} the computed aggregates.
+     * @since 2.3.0
+     */
+    aggregate(aggregates) {}
+
+    /**
+     * Groups the objects in the collection by the value of a property, so that
+     * aggregates can be computed for each group. The grouping and aggregation
+     * are done natively in a single pass when `aggregate()` is called on the
+     * returned grouping:
+     * ```js
+     * let perCategory = products.groupBy('category').aggregate({count: true, avg: 'price'});
+     * // perCategory = [{key: 'Books', count: 12, avg: {price: 9.5}}, {key: 'Games', ...}, ...]
+     * ```
+     *
+     * The result contains one object per distinct value of the property,
+     * including `null`, in the order in which the values first appear in the
+     * collection. Properties of any type except lists can be grouped by;
+     * grouping by a link groups by the linked object.
+     * @param {string} property - The property to group by.
+     * @returns {Object} a grouping with an `aggregate(aggregates)` method, which takes the
+     *   same description as {@link Realm.Collection#aggregate aggregate()}.
+     * @throws {Error} If the property doesn't exist or is a list, or if this is a
+     *   collection of primitive values (when `aggregate()` is called).
+     * @since 2.3.0
+     */
+    groupBy(property) {}
+
     /**
      * @see {@link https://developer.mozilla.org/en-US/docs/Web/JavaScript/Reference/Global_Objects/Array/forEach Array.prototype.forEach}
      * @param {function} callback - Function to execute on each object in the collection.
@@ -401,7 +504,7 @@ class Collection {
      *   - `collection`: the collection instance that changed,
      *   - `changes`: a dictionary with keys `insertions`, `modifications` and `deletions`,
      *      each containing a list of indices that were inserted, updated or deleted respectively.
-     * @throws {Error} If `callback` is not a function.
+     * @throws {Error} If `callback` is not a function, or if called in a Node.js worker thread.
      * @example
      * wines.addListener((collection, changes) => {
      *  // collection === wines
@@ -73,6 +73,59 @@ class List extends Collection {
      */
     splice(index, count, ...object) {}
 
+    /**
+     * Replaces the contents of the list with the values of an array in one call.
+     *
+     * With `{diff: true}`, a shortest edit script from the current contents to the new ones is
+     * computed natively, and only the values that differ are removed, inserted or set. Listeners
+     * then see small change sets instead of the whole list being replaced. Objects are matched
+     * by identity: Realm objects are used as they are, and plain objects are created or, if
+     * their type has a primary key, update the existing object with the same primary key.
+     * @example
+     * // Only the `Dune` entry is inserted; the other entries are kept.
+     * shelf.books.assign([hobbit, dune, emma], {diff: true});
+     * @param {T[]} values - The new contents of the list.
+     * @param {Object} [options]
+     * @param {boolean} [options.diff=false] - Whether to write only the differences.
+     * @throws {Error} If not inside a write transaction.
+     * @throws {TypeError} If a value is not of a type which can be stored in the list.
+     * @returns {number} equal to the new length of the list.
+     * @since 2.3.0
+     */
+    assign(values, options) {}
+
+    /**
+     * Add all values of an array or a TypedArray to the _end_ of the list in one call.
+     *
+     * The elements of a TypedArray are copied from its buffer straight into a list of type
+     * `int`, `float` or `double`, without converting each of them to a JavaScript value.
+     * Only integer TypedArrays (e.g. `Int32Array`) can be added to `int` lists.
+     * @example
+     * sensor.samples.pushAll(new Float64Array(readings));
+     * @param {T[]|TypedArray} values - Values to add to the list.
+     * @throws {Error} If not inside a write transaction.
+     * @throws {TypeError} If a value is not of a type which can be stored in the list.
+     * @returns {number} equal to the new {@link Realm.List#length length} of
+     *          the list after adding the values.
+     * @since 2.3.0
+     */
+    pushAll(values) {}
+
+    /**
+     * Copy the values of a list of type `int`, `float` or `double` into a new TypedArray.
+     *
+     * `null` values become `NaN` for `float` and `double` lists, and cannot be converted for
+     * `int` lists. Integer values which don't fit the chosen type wrap around as they would
+     * when assigned to the TypedArray.
+     * @param {string} [type] - The name of the TypedArray type to create, e.g. `'Int32Array'`.
+     *   Defaults to `'Float32Array'` for `float` lists and `'Float64Array'` otherwise. Integer
+     *   types can only be created from `int` lists.
+     * @throws {Error} If the list's type or a value cannot be converted to the requested type.
+     * @returns {TypedArray}
+     * @since 2.3.0
+     */
+    toTypedArray(type) {}
+
     /**
      * Add one or more values to the _beginning_ of the list.
      *
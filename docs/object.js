@@ -46,4 +46,37 @@ class Object {
      * @since 1.9.0
      */
     linkingObjects(objectType, property) {}
+
+    /**
+     * Returns the number of objects that link to this object in the specified relationship.
+     * This is faster than reading the `length` of {@link Realm.Object#linkingObjects linkingObjects()},
+     * as no collection is created for them.
+     * @param {string} objectType - The type of the objects that link to this object's type.
+     * @param {string} property - The name of the property that references objects of this object's type.
+     * @throws {Error} If the relationship is not valid.
+     * @returns {number} the number of objects that link to this object.
+     * @since 2.3.0
+     */
+    linkingObjectsCount(objectType, property) {}
+
+    /**
+     * Converts this object, and the objects it links to, into plain JavaScript objects and arrays
+     * in a single native pass. This is also used by `JSON.stringify()`.
+     *
+     * Links are followed up to `depth` levels deep, and if `include` is given, only along the
+     * listed key paths. A link which isn't followed, or which leads back to an object that is
+     * still being converted (a cycle), is replaced with the primary key of the linked object, or
+     * `null` if its type has no primary key. Linking objects properties are not included.
+     * @example
+     * // A post with its author and comments, but only the primary keys of the comments' authors
+     * post.toJSON({include: ['author', 'comments']})
+     * @param {Object} [options]
+     * @param {number} [options.depth=Infinity] - How many levels of links to follow.
+     * @param {string[]} [options.include] - The key paths of the links to follow,
+     *   e.g. `['author', 'comments.author']`.
+     * @throws {Error} If a key path in `include` is not a path of links.
+     * @returns {Object} a plain object with the values of this object's properties.
+     * @since 2.3.0
+     */
+    toJSON(options) {}
 }
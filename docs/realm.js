@@ -21,6 +21,12 @@
  * ```js
  * const Realm = require('realm');
  * ```
+ *
+ * In Node.js, Realms can also be opened in `worker_threads` to read and query them. Change
+ * notifications are only delivered on the main thread, so listeners, live aggregates and views
+ * can't be added in a worker thread, and a Realm opened in a worker isn't advanced when other
+ * instances commit changes. It keeps reading the version it started reading until it begins a
+ * write transaction or is closed and opened again.
  */
 class Realm {
    /**
@@ -130,9 +136,15 @@ class Realm {
      * @param {Realm~ObjectType} type - The type of Realm object to create.
      * @param {Object} properties - Property values for all required properties without a
      *   default value.
-     * @param {boolean} [update=false] - Signals that an existing object with matching primary key
+     * @param {boolean|Object} [update=false] - Signals that an existing object with matching primary key
      *   should be updated. Only the primary key property and properties which should be updated
      *   need to be specified. All missing property values will remain unchanged.
+     *   Instead of a boolean, an object `{update: mode}` may be given, where `mode` is `true`, `false`,
+     *   `'all'` (the same as `true`) or `'modified'`. With `'modified'`, each value is compared with the
+     *   stored value first and only values that differ are written, so updating an object with the
+     *   values it already has doesn't trigger change notifications. Linked objects with a primary key,
+     *   including those in lists, are updated in the same way, and a list is only written if it now
+     *   links to different objects. `NaN` is the same as a stored `NaN`.
      * @returns {Realm.Object}
      */
     create(type, properties, update) {}
@@ -154,6 +166,21 @@ class Realm {
      */
     deleteAll() {}
 
+    /**
+     * Deletes all objects of the given `type` which match the `query`. This is faster than
+     * deleting the results of {@link Realm#objects objects(type).filtered(query)}, as no
+     * collection is created for them.
+     * @param {Realm~ObjectType} type - The type of Realm objects to delete.
+     * @param {string} query - Query used to select the objects to delete, as for
+     *   {@link Realm.Collection#filtered filtered()}.
+     * @param {...any} [arg] - Each subsequent argument is used by the placeholders
+     *   (e.g. `$0`, `$1`, `$2`, …) in the query.
+     * @throws {Error} If not in a write transaction, or if the type or query are invalid.
+     * @returns {number} The number of objects deleted.
+     * @since 2.3.0
+     */
+    deleteWhere(type, query, ...arg) {}
+
     /**
      * Returns all objects of the given `type` in the Realm.
      * @param {Realm~ObjectType} type - The type of Realm objects to retrieve.
@@ -162,10 +189,114 @@ class Realm {
      */
     objects(type) {}
 
+    /**
+     * Counts the objects of the given `type`, or those which match the `query`. This is faster
+     * than reading the `length` of {@link Realm#objects objects(type).filtered(query)}, as no
+     * collection is created for them.
+     * @param {Realm~ObjectType} type - The type of Realm objects to count.
+     * @param {string} [query] - Query used to select the objects to count, as for
+     *   {@link Realm.Collection#filtered filtered()}.
+     * @param {...any} [arg] - Each subsequent argument is used by the placeholders
+     *   (e.g. `$0`, `$1`, `$2`, …) in the query.
+     * @throws {Error} If the type or query are invalid.
+     * @returns {number} The number of objects.
+     * @since 2.3.0
+     */
+    count(type, query, ...arg) {}
+
+    /**
+     * Checks whether there are objects of the given `type`, or objects which match the `query`.
+     * The search stops at the first match.
+     * @param {Realm~ObjectType} type - The type of Realm objects to look for.
+     * @param {string} [query] - Query used to select the objects, as for
+     *   {@link Realm.Collection#filtered filtered()}.
+     * @param {...any} [arg] - Each subsequent argument is used by the placeholders
+     *   (e.g. `$0`, `$1`, `$2`, …) in the query.
+     * @throws {Error} If the type or query are invalid.
+     * @returns {boolean} `true` if any object matches.
+     * @since 2.3.0
+     */
+    exists(type, query, ...arg) {}
+
+    /**
+     * Defines a named view: live {@link Realm.Results Results} of the objects of a type which
+     * match a query, optionally sorted, that are kept up to date for as long as the Realm is open.
+     *
+     * The query is re-run in the background after each change and the new results are handed over
+     * when the Realm refreshes, so {@link Realm#view view(name)} returns the same, already evaluated
+     * collection every time instead of running the query again. Defining a view with the name of an
+     * existing one replaces it.
+     *
+     * A view keeps the Realm open, even once nothing else refers to it, until the view is removed
+     * with {@link Realm#removeView removeView()} or the Realm is {@link Realm#close closed}. The
+     * query can't contain placeholders such as `$0`, since no arguments are kept for re-running it;
+     * values must be written in the query itself.
+     * @example
+     * realm.defineView('unread', 'Message', 'read == false', ['receivedAt', true]);
+     * let unread = realm.view('unread');
+     * @param {string} name - The name of the view.
+     * @param {Realm~ObjectType} type - The type of Realm objects in the view.
+     * @param {string} [query] - Query selecting the objects, as for
+     *   {@link Realm.Collection#filtered filtered()}, without placeholders.
+     * @param {string|Realm.Collection~SortDescriptor[]} [sort] - The property to sort on, or sort
+     *   descriptors, as for {@link Realm.Collection#sorted sorted()}.
+     * @throws {Error} If the type, query or sort descriptors are invalid, or if called in a Node.js
+     *   worker thread.
+     * @returns {Realm.Results} the view.
+     * @since 2.3.0
+     */
+    defineView(name, type, query, sort) {}
+
+    /**
+     * Returns a view defined with {@link Realm#defineView defineView()}.
+     * @param {string} name - The name of the view.
+     * @throws {Error} If no view with that name has been defined.
+     * @returns {Realm.Results} the view.
+     * @since 2.3.0
+     */
+    view(name) {}
+
+    /**
+     * Removes a view defined with {@link Realm#defineView defineView()}, which then stops being
+     * updated and no longer keeps the Realm open. Nothing happens if no view has that name.
+     * @param {string} name - The name of the view.
+     * @since 2.3.0
+     */
+    removeView(name) {}
+
+    /**
+     * Obtains a reference to an object or collection of this Realm which can be resolved by another
+     * instance of the Realm, typically on a worker thread, with
+     * {@link Realm#resolveThreadSafeReference resolveThreadSafeReference()}. The object or collection
+     * is then handed over at the version it was at here, without being looked up or queried again.
+     * The reference keeps this Realm at that version until it is resolved, released with
+     * {@link Realm.ThreadSafeReference#release release()}, or this Realm is closed.
+     * @param {Realm.Object|Realm.List|Realm.Results} value - The object or collection.
+     * @throws {Error} If called during a write transaction, or if `value` is of another Realm.
+     * @returns {Realm.ThreadSafeReference} the reference.
+     * @since 2.3.0
+     */
+    obtainThreadSafeReference(value) {}
+
+    /**
+     * Resolves a reference obtained with
+     * {@link Realm#obtainThreadSafeReference obtainThreadSafeReference()} by an instance of the same
+     * Realm, which may be on another worker thread. This Realm is advanced to the version the
+     * reference was obtained at if it is older. A reference can only be resolved once.
+     * @param {Realm.ThreadSafeReference|number} reference - The reference, or its
+     *   {@link Realm.ThreadSafeReference#id id}.
+     * @throws {Error} If the reference doesn't exist, has already been resolved, is of another Realm
+     *   file, or if called during a write transaction.
+     * @returns {Realm.Object|Realm.List|Realm.Results|null} the object or collection, or `null` if
+     *   the object or the object owning the list has been deleted.
+     * @since 2.3.0
+     */
+    resolveThreadSafeReference(reference) {}
+
     /**
      * Searches for a Realm object by its primary key.
      * @param {Realm~ObjectType} type - The type of Realm object to search for.
-     * @param {number|string} key - The primary key value of the object to search for.
+     * @param {number|bigint|string} key - The primary key value of the object to search for.
      * @throws {Error} If type passed into this method is invalid or if the object type did
      *   not have a `primaryKey` specified in its {@link Realm~ObjectSchema ObjectSchema}.
      * @returns {Realm.Object|undefined} if no object is found.
@@ -173,6 +304,20 @@ class Realm {
      */
     objectForPrimaryKey(type, key) {}
 
+    /**
+     * Searches for Realm objects by a list of primary keys. All the lookups are done in a single
+     * call, which is much faster than calling {@link Realm#objectForPrimaryKey objectForPrimaryKey}
+     * for each key.
+     * @param {Realm~ObjectType} type - The type of Realm objects to search for.
+     * @param {Array<number|bigint|string>} keys - The primary key values of the objects to search for.
+     * @throws {Error} If type passed into this method is invalid or if the object type did
+     *   not have a `primaryKey` specified in its {@link Realm~ObjectSchema ObjectSchema}.
+     * @returns {Array<Realm.Object|undefined>} with the object for each key in `keys`, in the
+     *   same order, and `undefined` for keys that no object has.
+     * @since 2.3.0
+     */
+    objectsForPrimaryKeys(type, keys) {}
+
     /**
      * Add a listener `callback` for the specified event `name`.
      * @param {string} name - The name of event that should cause the callback to be called.
@@ -180,7 +325,8 @@ class Realm {
      * @param {callback(Realm, string)} callback - Function to be called when the event occurs.
      *   Each callback will only be called once per event, regardless of the number of times
      *   it was added.
-     * @throws {Error} If an invalid event `name` is supplied, or if `callback` is not a function.
+     * @throws {Error} If an invalid event `name` is supplied, if `callback` is not a function, or if
+     *   called in a Node.js worker thread.
      */
     addListener(name, callback) {}
 
@@ -310,6 +456,23 @@ Realm.defaultPath;
  * @property {boolean} [disableFormatUpgrade=false] - Specifies if this Realm's file format should
  *    be automatically upgraded if it was created with an older version of the Realm library.
  *    If set to `true` and a file format upgrade is required, an error will be thrown instead.
+ * @property {string} [dateRepresentation="date"] - How values of `date` properties are returned:
+ *    `"date"` returns `Date` objects, `"milliseconds"` returns numbers of milliseconds since the
+ *    epoch (with a fractional part for sub-millisecond precision) and `"secondsNanoseconds"` returns
+ *    `[seconds, nanoseconds]` arrays. Avoiding `Date` objects makes reading many dates faster.
+ *    Date properties accept all three forms (as well as date strings) when written, whichever
+ *    representation is used for reading. Dates returned by `min()`, `max()` and `aggregate()` use
+ *    the same representation. All the open instances of a Realm share one
+ *    representation, so opening a Realm that is already open with a different one throws.
+ * @property {string} [integerRepresentation="number"] - How values of `int` properties are returned:
+ *    `"number"` returns numbers, which can only represent integers up to 2^53 exactly, while
+ *    `"bigint"` returns `BigInt`s, which represent every 64-bit value exactly. `"bigint"` requires
+ *    a JavaScript engine with `BigInt` support (Node.js 10.4 or later). `int` properties,
+ *    primary keys and query arguments accept `BigInt`s whichever representation is used.
+ *    The `min()`, `max()` and `sum()` of `int` properties, including those computed by
+ *    `aggregate()`, are returned in the same representation.
+ *    As with `dateRepresentation`, opening a Realm that is already open with a different
+ *    representation throws.
  * @property {Array<Realm~ObjectClass|Realm~ObjectSchema>} [schema] - Specifies all the
  *   object types in this Realm. **Required** when first creating a Realm at this `path`.
  *   If omitted, the schema will be read from the existing Realm file.
@@ -415,6 +578,9 @@ Realm.defaultPath;
  *   This is not supported for `"list"` properties of object types and `"linkingObjects"` properties.
  * @property {boolean} [indexed] - Signals if this property should be indexed. Only supported for
  *   `"string"`, `"int"`, and `"bool"` properties.
+ * @property {boolean} [fullTextIndexed] - Signals if the index used by
+ *   {@link Realm.Results#search search()} should be kept up to date for this property as changes
+ *   are made, rather than by the next search. Only supported for `"string"` properties. _Since 2.3.0._
  */
 
 /**
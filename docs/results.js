@@ -36,4 +36,51 @@ class Results extends Collection {
      * @since 2.0.0-rc20
      */
     update(property, value) {}
+
+    /**
+     * Search the objects in the collection for words in a string property.
+     *
+     * The text is split into words of letters and digits, and matched ignoring the case of ASCII
+     * letters. An object must contain all of the terms to be found, and a term ending in `*` matches
+     * any word that begins with it. The objects are ranked by how often they contain the terms,
+     * with rarer terms counting for more.
+     *
+     * The words are looked up in an index kept in memory for each Realm. The index of a property
+     * declared with `fullTextIndexed: true` is kept up to date as changes are committed or received,
+     * and the index of any other string property is built by its first search. Either way, only the
+     * objects whose text has changed are indexed again.
+     * @example
+     * let hits = realm.objects('Article').search('body', 'realm data*');
+     * @param {string} property - The name of a `string` property.
+     * @param {string|string[]} terms - The terms to search for.
+     * @throws {Error} If the property isn't a `string` property.
+     * @returns {Realm.Object[]} the matching objects, most relevant first.
+     * @since 2.3.0
+     */
+    search(property, terms) {}
+
+    /**
+     * Compute aggregates like {@link Realm.Collection#aggregate aggregate()} and keep them up to
+     * date as the results change.
+     *
+     * The returned object has the same shape as the one `aggregate()` returns. After each change to
+     * the results its values are updated from the insertions, deletions and modifications in the
+     * change set, without going over the other objects again, and `callback` is called. The value of
+     * each aggregated property is kept in memory for each object so that modified and deleted
+     * objects can be taken back out of the totals.
+     * @example
+     * let totals = realm.objects('Payment').liveAggregate({count: true, sum: 'amount'}, totals => {
+     *     console.log(`${totals.count} payments, ${totals.sum.amount} in total`);
+     * });
+     * @param {Object} aggregates - Which aggregates to compute, as for
+     *   {@link Realm.Collection#aggregate aggregate()}.
+     * @param {function(aggregates, changes)} callback - Called with the updated aggregates and the
+     *   changes, like a listener added with {@link Realm.Collection#addListener addListener()}. Remove it with
+     *   {@link Realm.Collection#removeListener removeListener()} to stop updating the aggregates.
+     * @throws {Error} If a property doesn't exist or doesn't support the aggregate,
+     *   if the results are of primitive values, or if called in a Node.js worker thread.
+     * @returns {Object} the aggregates, which are updated in place.
+     * @since 2.3.0
+     */
+    liveAggregate(aggregates, callback) {}
 }
@@ -490,6 +490,15 @@ class Session {
  * each specific Realm will be processes in serial in the order in which the
  * events occurred, but may not all be processed in the same child.
  *
+ * With the `inProcess` option the module is instead loaded into the calling
+ * process, and the change events of the notifier are passed to it as they are,
+ * rather than being serialized and sent to a child which opens the Realms again.
+ * If a function of the module returns a promise, the event counts as being
+ * processed until the promise settles, so `maxWorkers` limits how many events
+ * are processed concurrently. As the module shares the calling thread,
+ * `maxWorkers` then defaults to 1, so events are processed one at a time
+ * unless a higher limit is given.
+ *
  * @example
  * // my-worker.js
  * function onchange(path) {
@@ -515,9 +524,14 @@ class Worker {
      * @param {object} [options] - An object containing option properties to configure the worker.
      * Available properties are as follows:
      *
-     * * `maxWorkers`: The maximum number of child processes to spawn. Defaults to `os.cpus().length`.
+     * * `maxWorkers`: The maximum number of child processes to spawn. Defaults to `os.cpus().length`, or to 1
+     *   with `inProcess`.
      * * `env`: An object containing environment variables to set for the child process.
      * * `execArgv`: Command-line arguments to pass to the `node` worker processes.
+     * * `inProcess`: If `true`, the module is run in this process instead of in child processes. `env` and
+     *   `execArgv` are then ignored, and `maxWorkers` is the maximum number of events processed at once.
+     * * `maxQueuedChanges`: The maximum number of change events waiting to be processed. Once it is reached, no more
+     *   changes are taken from the notifier until events have been processed. Defaults to no limit.
      */
     constructor(moduleName, options = {}) {}
 }
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+
+/**
+ * A reference to a Realm object, {@link Realm.List List} or {@link Realm.Results Results} which
+ * can be resolved by another instance of the same Realm, for example one opened by a worker thread.
+ * It is obtained with {@link Realm#obtainThreadSafeReference obtainThreadSafeReference()}.
+ *
+ * JavaScript objects can't be passed to another worker thread, so the reference is passed by its
+ * {@link Realm.ThreadSafeReference#id id}. The reference keeps the Realm it was obtained from open
+ * at its version until it is resolved, and it can only be resolved once. A reference which won't be
+ * resolved should be {@link Realm.ThreadSafeReference#release released}, and references which are
+ * still unresolved when the Realm they were obtained from is closed are released then.
+ * @example
+ * // main thread
+ * let reference = realm.obtainThreadSafeReference(realm.objects('Order').filtered('shipped == false'));
+ * worker.postMessage(reference.id);
+ *
+ * // worker thread
+ * parentPort.on('message', id => {
+ *     let orders = realm.resolveThreadSafeReference(id);
+ * });
+ * @memberof Realm
+ * @since 2.3.0
+ */
+class ThreadSafeReference {
+    /**
+     * The id of the reference, which is unique in the process.
+     * @type {number}
+     * @readonly
+     * @since 2.3.0
+     */
+    get id() {}
+
+    /**
+     * What the reference is to: `'object'`, `'list'` or `'results'`.
+     * @type {string}
+     * @readonly
+     * @since 2.3.0
+     */
+    get type() {}
+
+    /**
+     * The type of the objects or values referred to, such as `'Order'` or `'int'`.
+     * @type {string}
+     * @readonly
+     * @since 2.3.0
+     */
+    get objectType() {}
+
+    /**
+     * Whether the reference has already been resolved or released.
+     * @type {boolean}
+     * @readonly
+     * @since 2.3.0
+     */
+    get isResolved() {}
+
+    /**
+     * Releases the reference without resolving it, so that the version of the Realm it was
+     * obtained at is no longer kept. Releasing a reference which has already been resolved or
+     * released does nothing.
+     * @since 2.3.0
+     */
+    release() {}
+}
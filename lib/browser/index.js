@@ -111,15 +111,40 @@ export default class Realm {
         return method.apply(this, [getObjectType(this, type), ...args]);
     }
 
+    deleteWhere(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'deleteWhere', true);
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
     objects(type, ...args) {
         let method = util.createMethod(objectTypes.REALM, 'objects');
         return method.apply(this, [getObjectType(this, type), ...args]);
     }
 
+    count(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'count');
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
+    exists(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'exists');
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
+
+    defineView(name, type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'defineView');
+        return method.apply(this, [name, getObjectType(this, type), ...args]);
+    }
+
     objectForPrimaryKey(type, ...args) {
         let method = util.createMethod(objectTypes.REALM, 'objectForPrimaryKey');
         return method.apply(this, [getObjectType(this, type), ...args]);
     }
+
+    objectsForPrimaryKeys(type, ...args) {
+        let method = util.createMethod(objectTypes.REALM, 'objectsForPrimaryKeys');
+        return method.apply(this, [getObjectType(this, type), ...args]);
+    }
 }
 
 // Non-mutating methods:
@@ -128,6 +153,8 @@ util.createMethods(Realm.prototype, objectTypes.REALM, [
     'removeListener',
     'removeAllListeners',
     'close',
+    'view',
+    'removeView',
     '_waitForDownload',
     '_objectForObjectId',
     '_subscribeToObjects',
@@ -29,6 +29,7 @@ export default class List extends Collection {
 createMethods(List.prototype, objectTypes.LIST, [
     'filtered',
     'sorted',
+    'distinct',
     'snapshot',
     'isValid',
     'indexOf',
@@ -36,6 +37,10 @@ createMethods(List.prototype, objectTypes.LIST, [
     'max',
     'sum',
     'avg',
+    'aggregate',
+    '_groupedAggregate',
+    'toJSON',
+    'toTypedArray',
     'addListener',
     'removeListener',
     'removeAllListeners',
@@ -48,6 +53,8 @@ createMethods(List.prototype, objectTypes.LIST, [
     'push',
     'unshift',
     'splice',
+    'assign',
+    'pushAll',
 ], true);
 
 export function createList(realmId, info) {
@@ -32,6 +32,8 @@ createMethods(RealmObject.prototype, objectTypes.OBJECT, [
     'isValid',
     'objectSchema',
     'linkingObjects',
+    'linkingObjectsCount',
+    'toJSON',
     '_objectId',
     '_isSameObject',
 ]);
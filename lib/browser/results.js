@@ -29,13 +29,19 @@ export default class Results extends Collection {
 createMethods(Results.prototype, objectTypes.RESULTS, [
     'filtered',
     'sorted',
+    'distinct',
     'snapshot',
     'isValid',
     'indexOf',
+    'search',
     'min',
     'max',
     'sum',
     'avg',
+    'aggregate',
+    '_groupedAggregate',
+    'liveAggregate',
+    'toJSON',
     'addListener',
     'removeListener',
     'removeAllListeners',
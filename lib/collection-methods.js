@@ -89,3 +89,16 @@ Object.defineProperty(iteratorPrototype, Symbol.iterator, {
 });
 
 exports[Symbol.iterator] = exports.values;
+
+exports.groupBy = {
+    value: function(property) {
+        var collection = this;
+        return {
+            aggregate: function(aggregates) {
+                return collection._groupedAggregate(property, aggregates);
+            }
+        };
+    },
+    configurable: true,
+    writable: true
+};
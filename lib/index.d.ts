@@ -16,7 +16,7 @@
 //
 ////////////////////////////////////////////////////////////////////////////
 
-// TypeScript Version: 2.3.2
+// TypeScript Version: 3.2
 // With great contributions to @akim95 on github
 
 declare namespace Realm {
@@ -37,6 +37,7 @@ declare namespace Realm {
         default?: any;
         optional?: boolean;
         indexed?: boolean;
+        fullTextIndexed?: boolean;
     }
 
     // properties types
@@ -86,6 +87,12 @@ declare namespace Realm {
         sync?: Realm.Sync.SyncConfiguration;
         deleteRealmIfMigrationNeeded?: boolean;
         disableFormatUpgrade?: boolean;
+        dateRepresentation?: 'date' | 'milliseconds' | 'secondsNanoseconds';
+        integerRepresentation?: 'number' | 'bigint';
+    }
+
+    interface CreateOptions {
+        update?: boolean | 'all' | 'modified';
     }
 
     // object props type
@@ -112,6 +119,16 @@ declare namespace Realm {
          * @returns Results<T>
          */
         linkingObjects<T>(objectType: string, property: string): Results<T>;
+
+        /**
+         * @returns number
+         */
+        linkingObjectsCount(objectType: string, property: string): number;
+
+        /**
+         * @returns any
+         */
+        toJSON(options?: ToJSONOptions): any;
     }
 
     const Object: {
@@ -132,6 +149,27 @@ declare namespace Realm {
 
     type CollectionChangeCallback<T> = (collection: Collection<T>, change: CollectionChangeSet) => void;
 
+    interface ToJSONOptions {
+        depth?: number;
+        include?: string[];
+    }
+
+    interface AggregateDescription {
+        count?: boolean;
+        min?: string | string[];
+        max?: string | string[];
+        sum?: string | string[];
+        avg?: string | string[];
+    }
+
+    interface AggregateResult {
+        count?: number;
+        min?: { [property: string]: number | bigint | Date | undefined };
+        max?: { [property: string]: number | bigint | Date | undefined };
+        sum?: { [property: string]: number | bigint };
+        avg?: { [property: string]: number | undefined };
+    }
+
     /**
      * Collection
      * @see { @link https://realm.io/docs/javascript/latest/api/Realm.Collection.html }
@@ -145,10 +183,14 @@ declare namespace Realm {
          */
         isValid(): boolean;
 
-        min(property?: string): number | Date | null;
-        max(property?: string): number | Date | null;
-        sum(property?: string): number | null;
+        min(property?: string): number | bigint | Date | null;
+        max(property?: string): number | bigint | Date | null;
+        sum(property?: string): number | bigint | null;
         avg(property?: string): number;
+        aggregate(aggregates: AggregateDescription): AggregateResult;
+        groupBy(property: string): {
+            aggregate(aggregates: AggregateDescription): Array<AggregateResult & { key: any }>;
+        };
 
         /**
          * @param  {string} query
@@ -161,6 +203,10 @@ declare namespace Realm {
         sorted(descriptor: SortDescriptor[]): Results<T>;
         sorted(descriptor: string, reverse?: boolean): Results<T>;
 
+        distinct(properties?: string | string[]): Results<T>;
+
+        toJSON(options?: ToJSONOptions): any[];
+
         /**
          * @returns Results
          */
@@ -217,8 +263,30 @@ declare namespace Realm {
          * @returns T
          */
         splice(index: number, count?: number, object?: any): T[];
+
+        /**
+         * @param  {T[]} values
+         * @param  {{diff?: boolean}} options?
+         * @returns number
+         */
+        assign(values: T[], options?: { diff?: boolean }): number;
+
+        /**
+         * @param  {T[] | TypedArray} values
+         * @returns number
+         */
+        pushAll(values: T[] | TypedArray): number;
+
+        /**
+         * @param  {string} type?
+         * @returns TypedArray
+         */
+        toTypedArray(type?: TypedArrayName): TypedArray;
     }
 
+    type TypedArray = Int8Array | Uint8Array | Uint8ClampedArray | Int16Array | Uint16Array | Int32Array | Uint32Array | Float32Array | Float64Array;
+    type TypedArrayName = 'Int8Array' | 'Uint8Array' | 'Uint8ClampedArray' | 'Int16Array' | 'Uint16Array' | 'Int32Array' | 'Uint32Array' | 'Float32Array' | 'Float64Array';
+
     const List: {
         readonly prototype: List<any>;
     };
@@ -235,11 +303,42 @@ declare namespace Realm {
          * @returns void
          */
         update(property: string, value: any): void;
+
+        /**
+         * @param  {string} property
+         * @param  {string|string[]} terms
+         * @returns T[]
+         */
+        search(property: string, terms: string | string[]): T[];
+
+        /**
+         * @param  {AggregateDescription} aggregates
+         * @param  {(aggregates: AggregateResult, change: CollectionChangeSet) => void} callback
+         * @returns AggregateResult
+         */
+        liveAggregate(aggregates: AggregateDescription, callback: (aggregates: AggregateResult, change: CollectionChangeSet) => void): AggregateResult;
     }
 
     const Results: {
         readonly prototype: Results<any>;
     };
+
+    /**
+     * ThreadSafeReference
+     * @see { @link https://realm.io/docs/javascript/latest/api/Realm.ThreadSafeReference.html }
+     */
+    interface ThreadSafeReference {
+        readonly id: number;
+        readonly type: 'object' | 'list' | 'results';
+        readonly objectType: string;
+        readonly isResolved: boolean;
+
+        release(): void;
+    }
+
+    const ThreadSafeReference: {
+        readonly prototype: ThreadSafeReference;
+    };
 }
 
 /**
@@ -521,10 +620,10 @@ declare class Realm {
     /**
      * @param  {string|Realm.ObjectClass|Function} type
      * @param  {T&Realm.ObjectPropsType} properties
-     * @param  {boolean} update?
+     * @param  {boolean|Realm.CreateOptions} update?
      * @returns T
      */
-    create<T>(type: string | Realm.ObjectClass | Function, properties: T & Realm.ObjectPropsType, update?: boolean): T;
+    create<T>(type: string | Realm.ObjectClass | Function, properties: T & Realm.ObjectPropsType, update?: boolean | Realm.CreateOptions): T;
 
     /**
      * @param  {Realm.Object|Realm.Object[]|Realm.List<any>|Realm.Results<any>|any} object
@@ -544,10 +643,25 @@ declare class Realm {
 
     /**
      * @param  {string|Realm.ObjectSchema|Function} type
-     * @param  {number|string} key
+     * @param  {string} query
+     * @param  {any[]} ...arg
+     * @returns number
+     */
+    deleteWhere(type: string | Realm.ObjectSchema | Function, query: string, ...arg: any[]): number;
+
+    /**
+     * @param  {string|Realm.ObjectSchema|Function} type
+     * @param  {number|bigint|string} key
      * @returns {T | undefined}
      */
-    objectForPrimaryKey<T>(type: string | Realm.ObjectSchema | Function, key: number | string): T | undefined;
+    objectForPrimaryKey<T>(type: string | Realm.ObjectSchema | Function, key: number | bigint | string): T | undefined;
+
+    /**
+     * @param  {string|Realm.ObjectSchema|Function} type
+     * @param  {Array<number|bigint|string>} keys
+     * @returns {Array<T | undefined>}
+     */
+    objectsForPrimaryKeys<T>(type: string | Realm.ObjectSchema | Function, keys: Array<number | bigint | string>): Array<T | undefined>;
 
     /**
      * @param  {string|Realm.ObjectType|Function} type
@@ -555,6 +669,55 @@ declare class Realm {
      */
     objects<T>(type: string | Realm.ObjectSchema | Function): Realm.Results<T>;
 
+    /**
+     * @param  {string|Realm.ObjectSchema|Function} type
+     * @param  {string} query?
+     * @param  {any[]} ...arg
+     * @returns number
+     */
+    count(type: string | Realm.ObjectSchema | Function, query?: string, ...arg: any[]): number;
+
+    /**
+     * @param  {string|Realm.ObjectSchema|Function} type
+     * @param  {string} query?
+     * @param  {any[]} ...arg
+     * @returns boolean
+     */
+    exists(type: string | Realm.ObjectSchema | Function, query?: string, ...arg: any[]): boolean;
+
+    /**
+     * @param  {string} name
+     * @param  {string|Realm.ObjectSchema|Function} type
+     * @param  {string} query?
+     * @param  {string|Realm.SortDescriptor[]} sort?
+     * @returns Realm.Results<T>
+     */
+    defineView<T>(name: string, type: string | Realm.ObjectSchema | Function, query?: string | null, sort?: string | Realm.SortDescriptor[]): Realm.Results<T>;
+
+    /**
+     * @param  {string} name
+     * @returns Realm.Results<T>
+     */
+    view<T>(name: string): Realm.Results<T>;
+
+    /**
+     * @param  {string} name
+     * @returns void
+     */
+    removeView(name: string): void;
+
+    /**
+     * @param  {Realm.Object|Realm.List<any>|Realm.Results<any>} value
+     * @returns Realm.ThreadSafeReference
+     */
+    obtainThreadSafeReference(value: Realm.Object | Realm.List<any> | Realm.Results<any>): Realm.ThreadSafeReference;
+
+    /**
+     * @param  {Realm.ThreadSafeReference|number} reference
+     * @returns any
+     */
+    resolveThreadSafeReference(reference: Realm.ThreadSafeReference | number): any;
+
     /**
      * @param  {string} name
      * @param  {()=>void} callback
@@ -41,6 +41,10 @@ class FunctionListener {
         return Promise.all(this.pending);
     }
 
+    get isSaturated() {
+        return false;
+    }
+
     matches(regex, event, fn) {
         return this.regexStr === regex && this.event === event && this.fn === fn;
     }
@@ -75,17 +79,24 @@ class FunctionListener {
 };
 
 class OutOfProcListener {
-    constructor(regex, regexStr, worker) {
+    constructor(regex, regexStr, worker, ondrain) {
         this.regex = regex;
         this.regexStr = regexStr;
         this.worker = worker;
+        this.ondrain = ondrain;
         this.seen = {};
+        worker._addDrainListener(ondrain);
     }
 
     stop() {
+        this.worker._removeDrainListener(this.ondrain);
         return this.worker.stop();
     }
 
+    get isSaturated() {
+        return this.worker.isSaturated;
+    }
+
     matches(regex, worker) {
         return this.regexStr === regex && this.worker === worker;
     }
@@ -103,6 +114,7 @@ class OutOfProcListener {
 
     onchange(changes) {
         if (!this.regex.test(changes.path)) {
+            changes.release();
             return;
         }
         this.worker.onchange(changes);
@@ -129,23 +141,15 @@ class Listener {
     }
 
     change() {
-        const changes = this.notifier.next();
-        if (!changes) {
-            return;
-        }
-
-        let refCount = 1;
-        changes.release = () => {
-            if (--refCount === 0) {
-                changes.close();
+        // Changes are left with the notifier while a worker has too many queued, and are
+        // pulled once its queue has drained.
+        while (!this.callbacks.some(c => c.isSaturated)) {
+            const changes = this.notifier.next();
+            if (!changes) {
+                return;
             }
+            this._dispatch(changes);
         }
-
-        for (const callback of this.callbacks) {
-            ++refCount;
-            callback.onchange(changes);
-        }
-        changes.release();
     }
 
     available(virtualPath) {
@@ -166,7 +170,7 @@ class Listener {
             this.callbacks.push(new FunctionListener(regex, regexStr, event, fn));
         }
         else if (event instanceof Worker) {
-            this.callbacks.push(new OutOfProcListener(regex, regexStr, event));
+            this.callbacks.push(new OutOfProcListener(regex, regexStr, event, () => this.change()));
         }
         else {
             throw new Error(`Invalid arguments: must supply either event name and callback function or a Worker, got (${event}, ${fn})`);
@@ -202,6 +206,21 @@ class Listener {
     }
 
     // helpers
+    _dispatch(changes) {
+        let refCount = 1;
+        changes.release = () => {
+            if (--refCount === 0) {
+                changes.close();
+            }
+        }
+
+        for (const callback of this.callbacks) {
+            ++refCount;
+            callback.onchange(changes);
+        }
+        changes.release();
+    }
+
     _notifyDownloadComplete() {
         if (!this.initComplete) {
             return;
@@ -31,16 +31,34 @@ const os = nodeRequire('os');
 class Worker {
     constructor(modulePath, options={}) {
         this.modulePath = modulePath;
-        this.maxWorkers = options.maxWorkers || os.cpus().length;
+        this.inProcess = !!options.inProcess;
+        // In process, the module shares this thread, so by default events are processed one at a time.
+        this.maxWorkers = options.maxWorkers || (this.inProcess ? 1 : os.cpus().length);
         this.env = options.env || {};
         this.execArgv = options.execArgv || {};
+        this.maxQueuedChanges = options.maxQueuedChanges || Infinity;
 
         this._workers = [];
         this._waiting = [];
         this._workQueue = [];
         this._changeObjects = {};
+        this._queuedChanges = 0;
+        this._drainListeners = [];
 
-        this._startWorker();
+        if (this.inProcess) {
+            // The module runs on this thread, and is handed the change objects of the notifier itself.
+            this._impl = nodeRequire(modulePath);
+            this._running = 0;
+        }
+        else {
+            this._startWorker();
+        }
+    }
+
+    // Whether as many changes as `maxQueuedChanges` are waiting for a worker. The notifier
+    // stops handing out changes until the queue has drained.
+    get isSaturated() {
+        return this._queuedChanges >= this.maxQueuedChanges;
     }
 
     onavailable(path) {
@@ -48,6 +66,15 @@ class Worker {
     }
 
     onchange(change) {
+        if (this._stopping) {
+            change.release();
+            return;
+        }
+        if (this.inProcess) {
+            this._push({message: 'change', change});
+            return;
+        }
+
         const serialized = change.serialize();
         change.refCount = (change.refCount || 0) + 1;
         this._changeObjects[serialized] = change;
@@ -67,10 +94,73 @@ class Worker {
             return;
         }
 
+        if (message.message === 'change') {
+            ++this._queuedChanges;
+        }
         this._workQueue.push(message);
         this._next();
     }
 
+    _shift() {
+        const message = this._workQueue.shift();
+        if (message.message === 'change' && this._queuedChanges-- === this.maxQueuedChanges) {
+            // Called later so that the notifier doesn't push more changes from within _next().
+            setImmediate(() => this._drainListeners.forEach(fn => fn()));
+        }
+        return message;
+    }
+
+    _addDrainListener(fn) {
+        this._drainListeners.push(fn);
+    }
+
+    _removeDrainListener(fn) {
+        this._drainListeners = this._drainListeners.filter(f => f !== fn);
+    }
+
+    _run(message) {
+        ++this._running;
+        new Promise(resolve => resolve(this._dispatch(message)))
+            .catch(err => console.error(`Unhandled error in worker ${this.modulePath}: ${err && err.stack || err}`))
+            .then(() => {
+                if (message.message === 'change') {
+                    message.change.release();
+                }
+                --this._running;
+                this._next();
+            });
+    }
+
+    // The in-process counterpart of notification-worker.js. A promise returned by the module keeps
+    // the worker busy until it settles.
+    _dispatch(message) {
+        const impl = this._impl;
+        switch (message.message) {
+            case 'available':
+                if (impl.onavailable) {
+                    return impl.onavailable(message.path);
+                }
+                break;
+            case 'change':
+                if (impl.onchange && !message.change.isEmpty) {
+                    return impl.onchange(message.change);
+                }
+                break;
+        }
+    }
+
+    _nextInProcess() {
+        if (this._stopping && this._workQueue.length === 0) {
+            if (this._running === 0) {
+                this._shutdownComplete();
+            }
+            return;
+        }
+        while (this._workQueue.length > 0 && this._running < this.maxWorkers) {
+            this._run(this._shift());
+        }
+    }
+
     _startWorker() {
         const child = cp.fork(__dirname + '/notification-worker.js', [], {
             env: this.env,
@@ -98,6 +188,10 @@ class Worker {
     }
 
     _next() {
+        if (this.inProcess) {
+            this._nextInProcess();
+            return;
+        }
         if (this._stopping && this._workQueue.length === 0) {
             for (const worker of this._workers) {
                 if (!worker.stopping) {
@@ -120,7 +214,7 @@ class Worker {
             return;
         }
         const worker = this._waiting.shift();
-        const message = this._workQueue.shift();
+        const message = this._shift();
         worker.send(message);
     }
 };
@@ -39,8 +39,7 @@ include $(PREBUILT_STATIC_LIBRARY)
 include $(CLEAR_VARS)
 LOCAL_MODULE := librealmreact
 
-LOCAL_SRC_FILES := vendor/base64.cpp
-LOCAL_SRC_FILES += src/js_realm.cpp
+LOCAL_SRC_FILES := src/js_realm.cpp
 LOCAL_SRC_FILES += src/rpc.cpp
 LOCAL_SRC_FILES += src/jsc/jsc_init.cpp
 LOCAL_SRC_FILES += src/jsc/jsc_value.cpp
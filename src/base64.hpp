@@ -0,0 +1,400 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+# if defined(__GNUC__)
+#  define REALM_JS_BASE64_SIMD 1
+#  define REALM_JS_BASE64_TARGET(isa) __attribute__((target(isa)))
+# elif defined(_MSC_VER) && defined(__AVX2__)
+// MSVC has no per-function target attributes, so only use the vector paths when the whole build targets AVX2.
+#  define REALM_JS_BASE64_SIMD 1
+#  define REALM_JS_BASE64_TARGET(isa)
+# endif
+#endif
+
+#ifndef REALM_JS_BASE64_SIMD
+# define REALM_JS_BASE64_SIMD 0
+#endif
+
+#if REALM_JS_BASE64_SIMD
+# include <immintrin.h>
+#endif
+
+namespace realm {
+namespace js {
+namespace base64 {
+
+// Standard (RFC 4648) base64 codec shared by the object accessor and the RPC server.
+// The x86 build picks an AVX2 or SSSE3 implementation at runtime and falls back to
+// the scalar implementation for the input tail and on every other architecture.
+
+static const size_t invalid = size_t(-1);
+
+inline size_t encoded_size(size_t size) {
+    return (size + 2) / 3 * 4;
+}
+
+// Upper bound of the number of bytes `decode()` writes for `size` characters of input.
+inline size_t decoded_size(size_t size) {
+    return (size + 3) / 4 * 3;
+}
+
+namespace _impl {
+
+static const char encode_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+struct DecodeTable {
+    uint8_t values[256];
+
+    DecodeTable() {
+        for (auto& value : values) {
+            value = 0xff;
+        }
+        for (uint8_t i = 0; i < 64; i++) {
+            values[static_cast<uint8_t>(encode_table[i])] = i;
+        }
+    }
+};
+
+inline const uint8_t* decode_table() {
+    static const DecodeTable table;
+    return table.values;
+}
+
+inline size_t encode_scalar(const uint8_t* in, size_t size, char* out) {
+    char* start = out;
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3) {
+        uint32_t triple = uint32_t(in[i]) << 16 | uint32_t(in[i + 1]) << 8 | in[i + 2];
+        *out++ = encode_table[triple >> 18];
+        *out++ = encode_table[(triple >> 12) & 0x3f];
+        *out++ = encode_table[(triple >> 6) & 0x3f];
+        *out++ = encode_table[triple & 0x3f];
+    }
+    if (i < size) {
+        uint32_t triple = uint32_t(in[i]) << 16;
+        if (i + 1 < size) {
+            triple |= uint32_t(in[i + 1]) << 8;
+        }
+        *out++ = encode_table[triple >> 18];
+        *out++ = encode_table[(triple >> 12) & 0x3f];
+        *out++ = i + 1 < size ? encode_table[(triple >> 6) & 0x3f] : '=';
+        *out++ = '=';
+    }
+    return out - start;
+}
+
+inline size_t decode_scalar(const char* in, size_t size, uint8_t* out) {
+    const uint8_t* table = decode_table();
+
+    // Up to two trailing padding characters are allowed, and padding may also be omitted entirely.
+    if (size % 4 == 0 && size && in[size - 1] == '=') {
+        size -= (size > 1 && in[size - 2] == '=') ? 2 : 1;
+    }
+    if (size % 4 == 1) {
+        return invalid;
+    }
+
+    uint8_t* start = out;
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        uint32_t a = table[static_cast<uint8_t>(in[i])], b = table[static_cast<uint8_t>(in[i + 1])];
+        uint32_t c = table[static_cast<uint8_t>(in[i + 2])], d = table[static_cast<uint8_t>(in[i + 3])];
+        if ((a | b | c | d) & 0x80) {
+            return invalid;
+        }
+        uint32_t triple = a << 18 | b << 12 | c << 6 | d;
+        *out++ = uint8_t(triple >> 16);
+        *out++ = uint8_t(triple >> 8);
+        *out++ = uint8_t(triple);
+    }
+    if (i < size) {
+        uint32_t a = table[static_cast<uint8_t>(in[i])], b = table[static_cast<uint8_t>(in[i + 1])];
+        uint32_t c = i + 2 < size ? table[static_cast<uint8_t>(in[i + 2])] : 0;
+        if ((a | b | c) & 0x80) {
+            return invalid;
+        }
+        uint32_t triple = a << 18 | b << 12 | c << 6;
+        *out++ = uint8_t(triple >> 16);
+        if (i + 2 < size) {
+            *out++ = uint8_t(triple >> 8);
+        }
+    }
+    return out - start;
+}
+
+#if REALM_JS_BASE64_SIMD
+
+// The vector kernels below follow Wojciech Muła and Daniel Lemire, "Faster Base64 Encoding and
+// Decoding Using AVX2 Instructions" (2018). They consume whole blocks only and leave the tail
+// (including any padding) to the scalar code.
+
+REALM_JS_BASE64_TARGET("ssse3")
+inline __m128i encode_lookup_ssse3(__m128i indices) {
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                            '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_lut, result), indices);
+}
+
+REALM_JS_BASE64_TARGET("ssse3")
+inline __m128i encode_unpack_ssse3(__m128i in) {
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t1, t3);
+}
+
+REALM_JS_BASE64_TARGET("ssse3")
+inline size_t encode_ssse3(const uint8_t* in, size_t size, char* out) {
+    size_t i = 0;
+    // Each block reads 16 bytes but only consumes 12 of them.
+    for (; i + 16 <= size; i += 12, out += 16) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), encode_lookup_ssse3(encode_unpack_ssse3(block)));
+    }
+    return i;
+}
+
+// Returns the 6-bit values of 16 characters, or sets `error` if any of them is outside the alphabet.
+REALM_JS_BASE64_TARGET("ssse3")
+inline __m128i decode_lookup_ssse3(__m128i in, bool& error) {
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+    __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+    __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+    __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+
+    __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(_mm_or_si128(digit, plus), slash));
+    error = _mm_movemask_epi8(valid) != 0xffff;
+
+    __m128i shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    shift = _mm_or_si128(shift, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    shift = _mm_or_si128(shift, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+    shift = _mm_or_si128(shift, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+    return _mm_add_epi8(in, shift);
+}
+
+REALM_JS_BASE64_TARGET("ssse3")
+inline __m128i decode_pack_ssse3(__m128i values) {
+    __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+REALM_JS_BASE64_TARGET("ssse3")
+inline size_t decode_ssse3(const char* in, size_t size, uint8_t* out, bool& error) {
+    size_t i = 0;
+    // Each block writes 16 bytes but only produces 12, so stay far enough from the end of the
+    // output buffer (and away from the padding in the last quantum).
+    for (; i + 24 <= size; i += 16, out += 12) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i values = decode_lookup_ssse3(block, error);
+        if (error) {
+            return i;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), decode_pack_ssse3(values));
+    }
+    return i;
+}
+
+REALM_JS_BASE64_TARGET("avx2")
+inline size_t encode_avx2(const uint8_t* in, size_t size, char* out) {
+    const __m256i shuffle = _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m256i shift_lut = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                               '/' - 63, 'A', 0, 0,
+                                               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                               '/' - 63, 'A', 0, 0);
+    size_t i = 0;
+    // Each block reads bytes [i, i + 28) and consumes 24 of them, 12 per 128-bit lane.
+    for (; i + 28 <= size; i += 24, out += 32) {
+        __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12));
+        __m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        block = _mm256_shuffle_epi8(block, shuffle);
+        __m256i t0 = _mm256_and_si256(block, _mm256_set1_epi32(0x0fc0fc00));
+        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i t2 = _mm256_and_si256(block, _mm256_set1_epi32(0x003f03f0));
+        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        result = _mm256_add_epi8(_mm256_shuffle_epi8(shift_lut, result), indices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), result);
+    }
+    return i;
+}
+
+REALM_JS_BASE64_TARGET("avx2")
+inline __m256i in_range_avx2(__m256i v, char first, char last) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(first - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), v));
+}
+
+REALM_JS_BASE64_TARGET("avx2")
+inline size_t decode_avx2(const char* in, size_t size, uint8_t* out, bool& error) {
+    size_t i = 0;
+    // Each block writes 32 bytes but only produces 24; see decode_ssse3().
+    for (; i + 44 <= size; i += 32, out += 24) {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i upper = in_range_avx2(block, 'A', 'Z');
+        __m256i lower = in_range_avx2(block, 'a', 'z');
+        __m256i digit = in_range_avx2(block, '0', '9');
+        __m256i plus = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('+'));
+        __m256i slash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('/'));
+
+        __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(_mm256_or_si256(digit, plus), slash));
+        if (_mm256_movemask_epi8(valid) != -1) {
+            error = true;
+            return i;
+        }
+
+        __m256i shift = _mm256_and_si256(upper, _mm256_set1_epi8(-'A'));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')));
+        shift = _mm256_or_si256(shift, _mm256_and_si256(slash, _mm256_set1_epi8(63 - '/')));
+        __m256i values = _mm256_add_epi8(block, shift);
+
+        __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                              2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), merged);
+    }
+    return i;
+}
+
+enum class Isa { Scalar, SSSE3, AVX2 };
+
+inline Isa detect_isa() {
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::AVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return Isa::SSSE3;
+    }
+    return Isa::Scalar;
+#else
+    return Isa::AVX2;
+#endif
+}
+
+inline Isa isa() {
+    static const Isa s_isa = detect_isa();
+    return s_isa;
+}
+
+#endif // REALM_JS_BASE64_SIMD
+
+} // namespace _impl
+
+// Encodes `size` bytes into `out`, which must hold at least `encoded_size(size)` characters.
+// Returns the number of characters written.
+inline size_t encode(const char* data, size_t size, char* out) {
+    auto in = reinterpret_cast<const uint8_t*>(data);
+    size_t consumed = 0;
+    char* start = out;
+#if REALM_JS_BASE64_SIMD
+    switch (_impl::isa()) {
+        case _impl::Isa::AVX2:
+            consumed = _impl::encode_avx2(in, size, out);
+            out += consumed / 3 * 4;
+            consumed += _impl::encode_ssse3(in + consumed, size - consumed, out);
+            break;
+        case _impl::Isa::SSSE3:
+            consumed = _impl::encode_ssse3(in, size, out);
+            break;
+        case _impl::Isa::Scalar:
+            break;
+    }
+    out = start + consumed / 3 * 4;
+#endif
+    out += _impl::encode_scalar(in + consumed, size - consumed, out);
+    return out - start;
+}
+
+// Decodes `size` characters into `out`, which must hold at least `decoded_size(size)` bytes.
+// Returns the number of bytes written, or `base64::invalid` if the input is not valid base64.
+inline size_t decode(const char* data, size_t size, char* out) {
+    auto bytes = reinterpret_cast<uint8_t*>(out);
+    size_t consumed = 0;
+#if REALM_JS_BASE64_SIMD
+    bool error = false;
+    switch (_impl::isa()) {
+        case _impl::Isa::AVX2:
+            consumed = _impl::decode_avx2(data, size, bytes, error);
+            if (!error) {
+                consumed += _impl::decode_ssse3(data + consumed, size - consumed, bytes + consumed / 4 * 3, error);
+            }
+            break;
+        case _impl::Isa::SSSE3:
+            consumed = _impl::decode_ssse3(data, size, bytes, error);
+            break;
+        case _impl::Isa::Scalar:
+            break;
+    }
+    if (error) {
+        return invalid;
+    }
+#endif
+    size_t written = _impl::decode_scalar(data + consumed, size - consumed, bytes + consumed / 4 * 3);
+    return written == invalid ? invalid : consumed / 4 * 3 + written;
+}
+
+inline std::string encode(const char* data, size_t size) {
+    std::string result(encoded_size(size), '\0');
+    result.resize(encode(data, size, &result[0]));
+    return result;
+}
+
+inline bool decode(const std::string& encoded, std::string& output) {
+    output.resize(decoded_size(encoded.size()));
+    size_t size = decode(encoded.data(), encoded.size(), &output[0]);
+    if (size == invalid) {
+        output.clear();
+        return false;
+    }
+    output.resize(size);
+    return true;
+}
+
+} // namespace base64
+} // namespace js
+} // namespace realm
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <realm/string_data.hpp>
+#include <realm/table.hpp>
+
+namespace realm {
+namespace js {
+namespace full_text {
+
+// Splits text into tokens: runs of ASCII letters and digits, and of non-ASCII bytes, so that UTF-8
+// encoded words are kept whole. ASCII letters are folded to lower case.
+inline std::vector<std::string> tokenize(StringData text) {
+    std::vector<std::string> tokens;
+    std::string token;
+    for (size_t i = 0; i < text.size(); i++) {
+        unsigned char c = text[i];
+        if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c >= 0x80) {
+            token += char(c);
+        }
+        else if (c >= 'A' && c <= 'Z') {
+            token += char(c - 'A' + 'a');
+        }
+        else if (!token.empty()) {
+            tokens.push_back(std::move(token));
+            token.clear();
+        }
+    }
+    if (!token.empty()) {
+        tokens.push_back(std::move(token));
+    }
+    return tokens;
+}
+
+// An inverted index from the tokens of the strings in a column to the rows containing them. Realm
+// keeps no log of which rows a write touched, so the text each row had when it was indexed is kept,
+// and update() only tokenizes the rows whose text has changed since.
+class Index {
+  public:
+    // Brings the index up to date with the column of `table`.
+    void update(const Table &table, size_t column) {
+        if (m_updated && m_version == table.get_version_counter()) {
+            return;
+        }
+
+        size_t size = table.size();
+        for (size_t row = size; row < m_texts.size(); row++) {
+            remove_row(row);
+        }
+        m_texts.resize(size);
+        for (size_t row = 0; row < size; row++) {
+            StringData text = table.get_string(column, row);
+            if (m_texts[row].size() != text.size() || !std::equal(m_texts[row].begin(), m_texts[row].end(), text.data())) {
+                remove_row(row);
+                m_texts[row].assign(text.data(), text.size());
+                add_row(row);
+            }
+        }
+        m_version = table.get_version_counter();
+        m_updated = true;
+    }
+
+    // Returns the rows which contain all of the given terms, most relevant first. A term ending in `*`
+    // matches every token beginning with the rest of it. Rows are scored by the sum over the terms of
+    // the number of times they contain a term weighted by how rare the term is (TF-IDF).
+    std::vector<size_t> search(const std::vector<std::string> &terms) const {
+        std::unordered_map<size_t, double> scores;
+        bool first = true;
+        for (auto &term : terms) {
+            bool prefix = !term.empty() && term.back() == '*';
+            auto tokens = tokenize(prefix ? StringData(term.data(), term.size() - 1) : StringData(term));
+            for (size_t i = 0; i < tokens.size(); i++) {
+                auto term_scores = score(tokens[i], prefix && i + 1 == tokens.size());
+                if (first) {
+                    scores = std::move(term_scores);
+                    first = false;
+                    continue;
+                }
+                for (auto it = scores.begin(); it != scores.end();) {
+                    auto match = term_scores.find(it->first);
+                    if (match == term_scores.end()) {
+                        it = scores.erase(it);
+                    }
+                    else {
+                        it->second += match->second;
+                        ++it;
+                    }
+                }
+            }
+        }
+
+        std::vector<std::pair<size_t, double>> ranked(scores.begin(), scores.end());
+        std::sort(ranked.begin(), ranked.end(), [](auto &a, auto &b) {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        });
+        std::vector<size_t> rows;
+        rows.reserve(ranked.size());
+        for (auto &entry : ranked) {
+            rows.push_back(entry.first);
+        }
+        return rows;
+    }
+
+  private:
+    struct Posting {
+        size_t row;
+        size_t count;
+    };
+
+    // Sorted by token, so that the tokens starting with a prefix are adjacent. The postings of each
+    // token are sorted by row.
+    std::map<std::string, std::vector<Posting>> m_postings;
+    std::vector<std::string> m_texts;
+    uint_fast64_t m_version = 0;
+    bool m_updated = false;
+
+    static bool before(const Posting &posting, size_t row) {
+        return posting.row < row;
+    }
+
+    void add_row(size_t row) {
+        std::map<std::string, size_t> counts;
+        for (auto &token : tokenize(m_texts[row])) {
+            counts[token]++;
+        }
+        for (auto &count : counts) {
+            auto &postings = m_postings[count.first];
+            postings.insert(std::lower_bound(postings.begin(), postings.end(), row, before), {row, count.second});
+        }
+    }
+
+    void remove_row(size_t row) {
+        for (auto &token : tokenize(m_texts[row])) {
+            auto it = m_postings.find(token);
+            if (it == m_postings.end()) {
+                continue; // a token occurring more than once
+            }
+            auto &postings = it->second;
+            auto posting = std::lower_bound(postings.begin(), postings.end(), row, before);
+            if (posting != postings.end() && posting->row == row) {
+                postings.erase(posting);
+            }
+            if (postings.empty()) {
+                m_postings.erase(it);
+            }
+        }
+    }
+
+    std::unordered_map<size_t, double> score(const std::string &token, bool prefix) const {
+        std::unordered_map<size_t, size_t> counts;
+        auto end = prefix ? m_postings.end() : m_postings.upper_bound(token);
+        for (auto it = m_postings.lower_bound(token); it != end; ++it) {
+            if (it->first.compare(0, token.size(), token) != 0 || (!prefix && it->first != token)) {
+                break;
+            }
+            for (auto &posting : it->second) {
+                counts[posting.row] += posting.count;
+            }
+        }
+
+        std::unordered_map<size_t, double> scores;
+        double idf = std::log(1.0 + double(m_texts.size()) / double(std::max<size_t>(counts.size(), 1)));
+        for (auto &count : counts) {
+            scores.emplace(count.first, double(count.second) * idf);
+        }
+        return scores;
+    }
+};
+
+} // namespace full_text
+} // namespace js
+} // namespace realm
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace realm {
+namespace js {
+namespace iso8601 {
+
+// Allocation-free parser for the ISO-8601 / RFC-3339 timestamps produced by JSON APIs, keeping up to
+// nanosecond precision. Accepted forms are a date (`2018-03-01`, which is UTC) optionally followed by
+// `T` (or a space) and `hh:mm[:ss[.fraction]]` with a `Z` or `±hh[:mm]` offset. Years may use the
+// extended `±yyyyyy` form.
+//
+// Date-times without an offset are rejected, as JavaScript interprets those in the local time zone;
+// callers should hand anything this doesn't accept to the Date constructor instead.
+
+struct Timestamp {
+    int64_t seconds;
+    int32_t nanoseconds; // has the same sign as `seconds`, like realm::Timestamp
+};
+
+namespace _impl {
+
+inline bool digits(const char*& p, const char* end, size_t count, int64_t& value) {
+    if (size_t(end - p) < count) {
+        return false;
+    }
+    value = 0;
+    for (size_t i = 0; i < count; i++, p++) {
+        if (*p < '0' || *p > '9') {
+            return false;
+        }
+        value = value * 10 + (*p - '0');
+    }
+    return true;
+}
+
+inline bool is_leap_year(int64_t year) {
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+inline int days_in_month(int64_t year, int64_t month) {
+    static const int days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    return month == 2 && is_leap_year(year) ? 29 : days[month - 1];
+}
+
+// Days since 1970-01-01 in the proleptic Gregorian calendar (http://howardhinnant.github.io/date_algorithms.html).
+inline int64_t days_from_civil(int64_t year, int64_t month, int64_t day) {
+    year -= month <= 2;
+    int64_t era = (year >= 0 ? year : year - 399) / 400;
+    int64_t year_of_era = year - era * 400;
+    int64_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + day_of_era - 719468;
+}
+
+} // namespace _impl
+
+// Returns false if `string` isn't a timestamp in one of the accepted forms.
+inline bool parse(const char* string, size_t size, Timestamp& result) {
+    using namespace _impl;
+
+    const char* p = string;
+    const char* end = string + size;
+
+    int64_t year, month, day;
+    if (p != end && (*p == '+' || *p == '-')) {
+        bool negative = *p++ == '-';
+        if (!digits(p, end, 6, year) || (negative && year == 0)) {
+            return false;
+        }
+        year = negative ? -year : year;
+    }
+    else if (!digits(p, end, 4, year)) {
+        return false;
+    }
+    if (p == end || *p++ != '-' || !digits(p, end, 2, month) || p == end || *p++ != '-' || !digits(p, end, 2, day)) {
+        return false;
+    }
+    if (month < 1 || month > 12 || day < 1 || day > days_in_month(year, month)) {
+        return false;
+    }
+
+    int64_t seconds = days_from_civil(year, month, day) * 86400;
+    int64_t nanoseconds = 0;
+
+    if (p != end) {
+        if (*p != 'T' && *p != 't' && *p != ' ') {
+            return false;
+        }
+        p++;
+
+        int64_t hour, minute, second = 0;
+        if (!digits(p, end, 2, hour) || p == end || *p++ != ':' || !digits(p, end, 2, minute)) {
+            return false;
+        }
+        if (p != end && *p == ':') {
+            p++;
+            if (!digits(p, end, 2, second)) {
+                return false;
+            }
+            if (p != end && (*p == '.' || *p == ',')) {
+                p++;
+                const char* fraction = p;
+                int64_t scale = 100000000;
+                for (; p != end && *p >= '0' && *p <= '9'; p++) {
+                    // digits beyond nanosecond precision are dropped
+                    nanoseconds += (*p - '0') * scale;
+                    scale /= 10;
+                }
+                if (p == fraction) {
+                    return false;
+                }
+            }
+        }
+        // 24:00:00 is midnight at the end of the day
+        if (hour > 24 || minute > 59 || second > 59 || (hour == 24 && (minute || second || nanoseconds))) {
+            return false;
+        }
+
+        if (p == end) {
+            return false; // local time
+        }
+
+        int64_t offset = 0;
+        if (*p == 'Z' || *p == 'z') {
+            p++;
+        }
+        else if (*p == '+' || *p == '-') {
+            bool negative = *p++ == '-';
+            int64_t offset_hours, offset_minutes = 0;
+            if (!digits(p, end, 2, offset_hours)) {
+                return false;
+            }
+            if (p != end) {
+                if (*p == ':') {
+                    p++;
+                }
+                if (!digits(p, end, 2, offset_minutes)) {
+                    return false;
+                }
+            }
+            if (offset_hours > 23 || offset_minutes > 59) {
+                return false;
+            }
+            offset = (offset_hours * 60 + offset_minutes) * 60;
+            offset = negative ? -offset : offset;
+        }
+        else {
+            return false;
+        }
+        if (p != end) {
+            return false;
+        }
+
+        seconds += hour * 3600 + minute * 60 + second - offset;
+    }
+
+    // Bring the nanoseconds to the sign of the seconds.
+    if (seconds < 0 && nanoseconds > 0) {
+        seconds += 1;
+        nanoseconds -= 1000000000;
+    }
+
+    result.seconds = seconds;
+    result.nanoseconds = static_cast<int32_t>(nanoseconds);
+    return true;
+}
+
+} // namespace iso8601
+} // namespace js
+} // namespace realm
@@ -0,0 +1,693 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "js_types.hpp"
+#include "js_util.hpp"
+
+#include "collection_notifications.hpp"
+#include "object_accessor.hpp"
+#include "object_schema.hpp"
+#include "property.hpp"
+#include "results.hpp"
+
+namespace realm {
+namespace js {
+
+template<typename>
+class NativeAccessor;
+
+// Computes several aggregates, possibly over several properties, in a single pass over the rows of
+// a collection. The aggregates are described by an object such as
+// `{count: true, sum: ['a', 'b'], min: 'c', avg: 'd'}`, and returned in the same shape, with the
+// value for each property: `{count: 10, sum: {a: 1, b: 2}, min: {c: 3}, avg: {d: 4}}`.
+template<typename T>
+class Aggregation {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using String = js::String<T>;
+    using Object = js::Object<T>;
+    using Value = js::Value<T>;
+
+  public:
+    // Running totals of every aggregate in the description, for one set of rows.
+    struct State {
+        struct Column {
+            size_t count = 0;
+            int64_t int_sum = 0;
+            double double_sum = 0;
+            int64_t int_min = 0, int_max = 0;
+            // Minima and maxima leave NaN out, so they're of the other values, which are counted here.
+            size_t ordered_double_count = 0;
+            double double_min = 0, double_max = 0;
+            Timestamp timestamp_min, timestamp_max;
+        };
+
+        size_t count = 0;
+        std::vector<Column> columns;
+    };
+
+    Aggregation(ContextType ctx, const ObjectSchema &object_schema, ObjectType description) {
+        static const String count_string = "count";
+        ValueType count_value = Object::get_property(ctx, description, count_string);
+        if (!Value::is_undefined(ctx, count_value)) {
+            m_count = Value::validated_to_boolean(ctx, count_value, "count");
+        }
+
+        static const struct {
+            const char *name;
+            AggregateFunc func;
+        } functions[] = {
+            {"min", AggregateFunc::Min},
+            {"max", AggregateFunc::Max},
+            {"sum", AggregateFunc::Sum},
+            {"avg", AggregateFunc::Avg},
+        };
+        for (auto &function : functions) {
+            ValueType value = Object::get_property(ctx, description, function.name);
+            if (Value::is_undefined(ctx, value)) {
+                continue;
+            }
+            if (!Value::is_array(ctx, value)) {
+                add_column(object_schema, function.func, Value::validated_to_string(ctx, value, function.name));
+                continue;
+            }
+            ObjectType names = Value::to_array(ctx, value);
+            uint32_t count = Object::validated_get_length(ctx, names);
+            for (uint32_t i = 0; i < count; i++) {
+                add_column(object_schema, function.func, Value::validated_to_string(ctx, Object::get_property(ctx, names, i), function.name));
+            }
+        }
+    }
+
+    State make_state() const {
+        State state;
+        state.columns.resize(m_columns.size());
+        return state;
+    }
+
+    void accumulate(State &state, const RowExpr &row) const {
+        state.count++;
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            auto &column = m_columns[i];
+            auto &totals = state.columns[i];
+            size_t index = column.property->table_column;
+            if (row.is_null(index)) {
+                continue;
+            }
+
+            bool first = totals.count++ == 0;
+            switch (column.property->type & ~PropertyType::Flags) {
+                case PropertyType::Int: {
+                    int64_t value = row.get_int(index);
+                    totals.int_sum += value;
+                    totals.int_min = first || value < totals.int_min ? value : totals.int_min;
+                    totals.int_max = first || value > totals.int_max ? value : totals.int_max;
+                    break;
+                }
+                case PropertyType::Float:
+                case PropertyType::Double: {
+                    double value = (column.property->type & ~PropertyType::Flags) == PropertyType::Float
+                        ? row.get_float(index) : row.get_double(index);
+                    totals.double_sum += value;
+                    if (!std::isnan(value)) {
+                        bool first_ordered = totals.ordered_double_count++ == 0;
+                        totals.double_min = first_ordered || value < totals.double_min ? value : totals.double_min;
+                        totals.double_max = first_ordered || value > totals.double_max ? value : totals.double_max;
+                    }
+                    break;
+                }
+                case PropertyType::Date: {
+                    Timestamp value = row.get_timestamp(index);
+                    totals.timestamp_min = first || value < totals.timestamp_min ? value : totals.timestamp_min;
+                    totals.timestamp_max = first || value > totals.timestamp_max ? value : totals.timestamp_max;
+                    break;
+                }
+                default:
+                    REALM_UNREACHABLE();
+            }
+        }
+    }
+
+    // Sets the results for `state` as properties of `object`. Integers and dates are returned in the
+    // representation `accessor` uses for property values.
+    void set_results(ContextType ctx, NativeAccessor<T> &accessor, const State &state, ObjectType object) const {
+        if (m_count) {
+            Object::set_property(ctx, object, "count", Value::from_number(ctx, state.count));
+        }
+
+        static const char *const names[] = {"min", "max", "sum", "avg"};
+        ObjectType results[4] = {};
+        bool has_results[4] = {};
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            auto &column = m_columns[i];
+            size_t func = static_cast<size_t>(column.func);
+            if (!has_results[func]) {
+                results[func] = Object::create_empty(ctx);
+                has_results[func] = true;
+                Object::set_property(ctx, object, names[func], results[func]);
+            }
+            Object::set_property(ctx, results[func], column.property->name, value(ctx, accessor, column, state.columns[i]));
+        }
+    }
+
+    size_t size() const {
+        return m_columns.size();
+    }
+
+  private:
+    template<typename>
+    friend class IncrementalAggregation;
+
+    struct Column {
+        AggregateFunc func;
+        const Property *property;
+    };
+
+    bool m_count = false;
+    std::vector<Column> m_columns;
+
+    void add_column(const ObjectSchema &object_schema, AggregateFunc func, const std::string &property_name) {
+        const Property *property = object_schema.property_for_name(property_name);
+        if (!property) {
+            throw std::invalid_argument(util::format("Property '%1' does not exist on object '%2'",
+                                                     property_name, object_schema.name));
+        }
+
+        auto type = property->type & ~PropertyType::Flags;
+        bool numeric = type == PropertyType::Int || type == PropertyType::Float || type == PropertyType::Double;
+        bool supported = !realm::is_array(property->type) &&
+            (numeric || (type == PropertyType::Date && (func == AggregateFunc::Min || func == AggregateFunc::Max)));
+        if (!supported) {
+            static const char *const names[] = {"min", "max", "sum", "avg"};
+            throw std::invalid_argument(util::format("Cannot compute %1 of property '%2' of type '%3'",
+                                                     names[static_cast<size_t>(func)], property_name,
+                                                     string_for_property_type(property->type)));
+        }
+        m_columns.push_back({func, property});
+    }
+
+    static ValueType value(ContextType ctx, NativeAccessor<T> &accessor, const Column &column, const typename State::Column &totals) {
+        auto type = column.property->type & ~PropertyType::Flags;
+        if (column.func == AggregateFunc::Sum) {
+            return type == PropertyType::Int ? accessor.box(totals.int_sum) : Value::from_number(ctx, totals.double_sum);
+        }
+        if (totals.count == 0) {
+            return Value::from_undefined(ctx);
+        }
+        bool is_double = type == PropertyType::Float || type == PropertyType::Double;
+        if (column.func != AggregateFunc::Avg && is_double && totals.ordered_double_count == 0) {
+            // only NaN
+            return Value::from_undefined(ctx);
+        }
+
+        switch (column.func) {
+            case AggregateFunc::Avg:
+                return Value::from_number(ctx, (type == PropertyType::Int ? totals.int_sum : totals.double_sum) / totals.count);
+            case AggregateFunc::Min:
+                if (type == PropertyType::Date) {
+                    return accessor.box(totals.timestamp_min);
+                }
+                return type == PropertyType::Int ? accessor.box(totals.int_min) : Value::from_number(ctx, totals.double_min);
+            case AggregateFunc::Max:
+                if (type == PropertyType::Date) {
+                    return accessor.box(totals.timestamp_max);
+                }
+                return type == PropertyType::Int ? accessor.box(totals.int_max) : Value::from_number(ctx, totals.double_max);
+            default:
+                REALM_UNREACHABLE();
+        }
+    }
+};
+
+// Keeps the aggregates described as for Aggregation up to date as the objects in a Results change,
+// by applying the change sets of its notifications rather than going over all of the objects again.
+// The notifier doesn't report the values that modified or deleted objects had before the change, so
+// the value of each aggregated property is kept for each object in order to take it back out of the
+// totals. Minima and maxima are kept as ordered multisets of the values, so that removing the current
+// minimum or maximum doesn't need a scan either.
+template<typename T>
+class IncrementalAggregation {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+
+  public:
+    IncrementalAggregation(ContextType ctx, const ObjectSchema &object_schema, ObjectType description)
+    : m_object_schema(object_schema)
+    , m_aggregation(ctx, m_object_schema, description)
+    , m_columns(m_aggregation.size()) { }
+
+    // The aggregation refers to the properties of m_object_schema.
+    IncrementalAggregation(const IncrementalAggregation &) = delete;
+    IncrementalAggregation &operator=(const IncrementalAggregation &) = delete;
+
+    // Computes the aggregates over all of the objects in `results`.
+    void reset(realm::Results &results) {
+        m_columns.assign(m_aggregation.size(), Column());
+        m_samples.clear();
+        m_size = results.size();
+        m_samples.resize(m_size * m_columns.size());
+        for (size_t i = 0; i < m_size; i++) {
+            Sample *samples = &m_samples[i * m_columns.size()];
+            take_samples(results.get(i), samples);
+            add(samples);
+        }
+    }
+
+    // Updates the aggregates for a change to `results`, which must already be at the new version.
+    void apply(realm::Results &results, const CollectionChangeSet &changes) {
+        // The first notification reports no changes, whatever happened between the call to reset()
+        // and the version it is delivered for.
+        if (!m_notified) {
+            m_notified = true;
+            reset(results);
+            return;
+        }
+
+        size_t width = m_columns.size();
+        size_t removed = 0;
+        for (auto range : changes.deletions) {
+            auto first = m_samples.begin() + (range.first - removed) * width;
+            auto last = m_samples.begin() + (range.second - removed) * width;
+            for (auto it = first; it != last; it += width) {
+                remove(&*it);
+            }
+            m_samples.erase(first, last);
+            removed += range.second - range.first;
+        }
+        m_size -= removed;
+
+        for (auto range : changes.insertions) {
+            std::vector<Sample> inserted((range.second - range.first) * width);
+            for (size_t i = range.first; i < range.second; i++) {
+                Sample *samples = &inserted[(i - range.first) * width];
+                take_samples(results.get(i), samples);
+                add(samples);
+            }
+            m_samples.insert(m_samples.begin() + range.first * width, inserted.begin(), inserted.end());
+            m_size += range.second - range.first;
+        }
+
+        for (size_t i : changes.modifications_new.as_indexes()) {
+            Sample *samples = &m_samples[i * width];
+            remove(samples);
+            take_samples(results.get(i), samples);
+            add(samples);
+        }
+
+        if (m_size != results.size()) {
+            reset(results);
+        }
+    }
+
+    // Sets the current aggregates as properties of `object`, in the shape Aggregation returns them.
+    void set_results(ContextType ctx, const realm::Results &results, ObjectType object) const {
+        auto state = m_aggregation.make_state();
+        state.count = m_size;
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            auto &column = m_columns[i];
+            auto &totals = state.columns[i];
+            totals.count = column.count;
+            totals.int_sum = column.int_sum;
+            totals.double_sum = column.double_sum();
+            if (!column.ints.empty()) {
+                totals.int_min = *column.ints.begin();
+                totals.int_max = *column.ints.rbegin();
+            }
+            totals.ordered_double_count = column.doubles.size();
+            if (!column.doubles.empty()) {
+                totals.double_min = *column.doubles.begin();
+                totals.double_max = *column.doubles.rbegin();
+            }
+            if (!column.timestamps.empty()) {
+                totals.timestamp_min = *column.timestamps.begin();
+                totals.timestamp_max = *column.timestamps.rbegin();
+            }
+        }
+        NativeAccessor<T> accessor(ctx, results);
+        m_aggregation.set_results(ctx, accessor, state, object);
+    }
+
+  private:
+    // The value of one aggregated property of one object.
+    struct Sample {
+        bool is_null = true;
+        int64_t int_value = 0;
+        double double_value = 0;
+        Timestamp timestamp_value;
+    };
+
+    // Sums of doubles are kept as the sum of the finite values and counts of the others, as NaN and
+    // infinities can't be subtracted back out of a sum. The finite sum is compensated for rounding
+    // (Neumaier's variant of Kahan summation), so that adding and removing values doesn't drift.
+    struct Column {
+        size_t count = 0;
+        int64_t int_sum = 0;
+        double finite_sum = 0;
+        double compensation = 0;
+        size_t nan_count = 0;
+        size_t positive_infinity_count = 0;
+        size_t negative_infinity_count = 0;
+        // Only kept for minima and maxima.
+        std::multiset<int64_t> ints;
+        std::multiset<double> doubles;
+        std::multiset<Timestamp> timestamps;
+
+        size_t *non_finite_count(double value) {
+            if (std::isnan(value)) {
+                return &nan_count;
+            }
+            if (std::isinf(value)) {
+                return value > 0 ? &positive_infinity_count : &negative_infinity_count;
+            }
+            return nullptr;
+        }
+
+        void add_finite(double value) {
+            double sum = finite_sum + value;
+            compensation += std::abs(finite_sum) >= std::abs(value) ? (finite_sum - sum) + value : (value - sum) + finite_sum;
+            finite_sum = sum;
+        }
+
+        void add_double(double value) {
+            if (size_t *counter = non_finite_count(value)) {
+                ++*counter;
+            }
+            else {
+                add_finite(value);
+            }
+        }
+
+        // Called once `count` no longer includes the value.
+        void remove_double(double value) {
+            if (size_t *counter = non_finite_count(value)) {
+                --*counter;
+            }
+            else {
+                add_finite(-value);
+            }
+            if (count == 0) {
+                finite_sum = compensation = 0;
+            }
+        }
+
+        double double_sum() const {
+            if (nan_count || (positive_infinity_count && negative_infinity_count)) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            if (positive_infinity_count || negative_infinity_count) {
+                return positive_infinity_count ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
+            }
+            return finite_sum + compensation;
+        }
+    };
+
+    // A copy, so that the properties the aggregation refers to outlive changes to the Realm's schema.
+    ObjectSchema m_object_schema;
+    Aggregation<T> m_aggregation;
+    std::vector<Column> m_columns;
+    // The samples of each object in the order of the Results, m_columns.size() per object.
+    std::vector<Sample> m_samples;
+    size_t m_size = 0;
+    bool m_notified = false;
+
+    void take_samples(const RowExpr &row, Sample *samples) const {
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            auto &property = *m_aggregation.m_columns[i].property;
+            size_t index = property.table_column;
+            auto &sample = samples[i];
+            sample = Sample();
+            if (row.is_null(index)) {
+                continue;
+            }
+
+            sample.is_null = false;
+            switch (property.type & ~PropertyType::Flags) {
+                case PropertyType::Int:
+                    sample.int_value = row.get_int(index);
+                    break;
+                case PropertyType::Float:
+                    sample.double_value = row.get_float(index);
+                    break;
+                case PropertyType::Double:
+                    sample.double_value = row.get_double(index);
+                    break;
+                case PropertyType::Date:
+                    sample.timestamp_value = row.get_timestamp(index);
+                    break;
+                default:
+                    REALM_UNREACHABLE();
+            }
+        }
+    }
+
+    bool keeps_values(size_t column) const {
+        auto func = m_aggregation.m_columns[column].func;
+        return func == AggregateFunc::Min || func == AggregateFunc::Max;
+    }
+
+    void add(const Sample *samples) {
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            auto &sample = samples[i];
+            if (sample.is_null) {
+                continue;
+            }
+
+            auto &column = m_columns[i];
+            column.count++;
+            switch (m_aggregation.m_columns[i].property->type & ~PropertyType::Flags) {
+                case PropertyType::Int:
+                    column.int_sum += sample.int_value;
+                    if (keeps_values(i)) {
+                        column.ints.insert(sample.int_value);
+                    }
+                    break;
+                case PropertyType::Float:
+                case PropertyType::Double:
+                    column.add_double(sample.double_value);
+                    // NaN has no place in the ordering of a multiset, so it's left out of minima and maxima.
+                    if (keeps_values(i) && !std::isnan(sample.double_value)) {
+                        column.doubles.insert(sample.double_value);
+                    }
+                    break;
+                case PropertyType::Date:
+                    column.timestamps.insert(sample.timestamp_value);
+                    break;
+                default:
+                    REALM_UNREACHABLE();
+            }
+        }
+    }
+
+    void remove(const Sample *samples) {
+        for (size_t i = 0; i < m_columns.size(); i++) {
+            auto &sample = samples[i];
+            if (sample.is_null) {
+                continue;
+            }
+
+            auto &column = m_columns[i];
+            column.count--;
+            switch (m_aggregation.m_columns[i].property->type & ~PropertyType::Flags) {
+                case PropertyType::Int:
+                    column.int_sum -= sample.int_value;
+                    if (keeps_values(i)) {
+                        column.ints.erase(column.ints.find(sample.int_value));
+                    }
+                    break;
+                case PropertyType::Float:
+                case PropertyType::Double:
+                    column.remove_double(sample.double_value);
+                    if (keeps_values(i) && !std::isnan(sample.double_value)) {
+                        column.doubles.erase(column.doubles.find(sample.double_value));
+                    }
+                    break;
+                case PropertyType::Date:
+                    column.timestamps.erase(column.timestamps.find(sample.timestamp_value));
+                    break;
+                default:
+                    REALM_UNREACHABLE();
+            }
+        }
+    }
+};
+
+template<typename T>
+void compute_aggregates_on_collection(typename T::ContextType ctx, typename T::ObjectType this_object,
+                                      typename T::Arguments args, typename T::ReturnValue &return_value) {
+    using Type = typename T::Type;
+
+    args.validate_maximum(1);
+    auto collection = get_internal<Type, T>(this_object);
+    if (collection->get_type() != realm::PropertyType::Object) {
+        throw std::runtime_error("Aggregating non-object Lists and Results is not yet implemented.");
+    }
+
+    auto description = T::Value::validated_to_object(ctx, args[0], "aggregates");
+    Aggregation<Type> aggregation(ctx, collection->get_object_schema(), description);
+    auto state = aggregation.make_state();
+
+    size_t size = collection->size();
+    for (size_t i = 0; i < size; i++) {
+        aggregation.accumulate(state, collection->get(i));
+    }
+
+    NativeAccessor<Type> accessor(ctx, *collection);
+    auto result = js::Object<Type>::create_empty(ctx);
+    aggregation.set_results(ctx, accessor, state, result);
+    return_value.set(result);
+}
+
+namespace _impl {
+
+template<typename U>
+void append_bytes(std::string &key, U value) {
+    char bytes[sizeof(U)];
+    std::memcpy(bytes, &value, sizeof(U));
+    key.append(bytes, sizeof(U));
+}
+
+// Sets `key` to a byte string which is equal for rows with equal values of `property`.
+inline void make_group_key(const RowExpr &row, const Property &property, std::string &key) {
+    key.clear();
+    size_t column = property.table_column;
+    auto type = property.type & ~PropertyType::Flags;
+    if (type == PropertyType::Object ? row.is_null_link(column) : row.is_null(column)) {
+        key.push_back(0);
+        return;
+    }
+    key.push_back(1);
+
+    switch (type) {
+        case PropertyType::Bool:
+            key.push_back(row.get_bool(column));
+            break;
+        case PropertyType::Int:
+            append_bytes(key, row.get_int(column));
+            break;
+        case PropertyType::Float: {
+            float value = row.get_float(column);
+            append_bytes(key, value == 0 ? 0.0f : value); // -0 and 0 are one group
+            break;
+        }
+        case PropertyType::Double: {
+            double value = row.get_double(column);
+            append_bytes(key, value == 0 ? 0.0 : value);
+            break;
+        }
+        case PropertyType::String: {
+            StringData value = row.get_string(column);
+            key.append(value.data(), value.size());
+            break;
+        }
+        case PropertyType::Data: {
+            BinaryData value = row.get_binary(column);
+            key.append(value.data(), value.size());
+            break;
+        }
+        case PropertyType::Date: {
+            Timestamp value = row.get_timestamp(column);
+            append_bytes(key, value.get_seconds());
+            append_bytes(key, value.get_nanoseconds());
+            break;
+        }
+        case PropertyType::Object:
+            append_bytes(key, row.get_link(column));
+            break;
+        default:
+            REALM_UNREACHABLE();
+    }
+}
+
+} // namespace _impl
+
+// Hash aggregation of the objects in a collection by the value of one property. Returns an array of
+// `{key, ...aggregates}` objects, one per distinct value, in the order in which the values first
+// appear in the collection.
+template<typename T>
+void compute_grouped_aggregates_on_collection(typename T::ContextType ctx, typename T::ObjectType this_object,
+                                              typename T::Arguments args, typename T::ReturnValue &return_value) {
+    using Type = typename T::Type;
+    using ValueType = typename Type::Value;
+    using Object = js::Object<Type>;
+    using Value = js::Value<Type>;
+
+    args.validate_count(2);
+    auto collection = get_internal<Type, T>(this_object);
+    if (collection->get_type() != realm::PropertyType::Object) {
+        throw std::runtime_error("Grouping non-object Lists and Results is not yet implemented.");
+    }
+
+    auto &object_schema = collection->get_object_schema();
+    std::string property_name = Value::validated_to_string(ctx, args[0], "property");
+    const Property *property = object_schema.property_for_name(property_name);
+    if (!property) {
+        throw std::invalid_argument(util::format("Property '%1' does not exist on object '%2'",
+                                                 property_name, object_schema.name));
+    }
+    if (realm::is_array(property->type)) {
+        throw std::invalid_argument(util::format("Cannot group by property '%1' of type '%2'",
+                                                 property_name, string_for_property_type(property->type)));
+    }
+
+    Aggregation<Type> aggregation(ctx, object_schema, Value::validated_to_object(ctx, args[1], "aggregates"));
+
+    struct Group {
+        size_t first_index;
+        typename Aggregation<Type>::State state;
+    };
+    std::vector<Group> groups;
+    std::unordered_map<std::string, size_t> group_indexes;
+    std::string key;
+
+    size_t size = collection->size();
+    for (size_t i = 0; i < size; i++) {
+        auto row = collection->get(i);
+        _impl::make_group_key(row, *property, key);
+        auto inserted = group_indexes.emplace(key, groups.size());
+        if (inserted.second) {
+            groups.push_back({i, aggregation.make_state()});
+        }
+        aggregation.accumulate(groups[inserted.first->second].state, row);
+    }
+
+    NativeAccessor<Type> accessor(ctx, *collection);
+    std::vector<ValueType> results;
+    results.reserve(groups.size());
+    for (auto &group : groups) {
+        realm::Object realm_object(collection->get_realm(), object_schema, collection->get(group.first_index));
+        auto result = Object::create_empty(ctx);
+        Object::set_property(ctx, result, "key", realm_object.template get_property_value<ValueType>(accessor, property->name));
+        aggregation.set_results(ctx, accessor, group.state, result);
+        results.push_back(result);
+    }
+    return_value.set(Object::create_array(ctx, results));
+}
+
+} // js
+} // realm
@@ -18,12 +18,17 @@
 
 #pragma once
 
+#include "js_aggregate.hpp"
 #include "js_collection.hpp"
 #include "js_object_accessor.hpp"
 #include "js_realm_object.hpp"
 #include "js_results.hpp"
 #include "js_types.hpp"
 #include "js_util.hpp"
+#include "list_diff.hpp"
+
+#include <cstring>
+#include <limits>
 
 #include "shared_realm.hpp"
 #include "list.hpp"
@@ -43,6 +48,133 @@ class List : public realm::List {
     std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_notification_tokens;
 };
 
+namespace _impl {
+
+// How the elements of a list of U are compared when diffing it against new contents. The keys of
+// strings and binary data own their bytes, as unboxed values point into the accessor's buffers.
+template<typename U>
+struct ListDiffKey {
+    using Key = U;
+    static Key from_list(realm::List &list, size_t index) { return list.template get<U>(index); }
+    template<typename Accessor, typename ValueType>
+    static Key from_value(Accessor &accessor, ValueType value) { return accessor.template unbox<U>(value); }
+    static U value(const Key &key) { return key; }
+};
+
+template<>
+struct ListDiffKey<StringData> {
+    using Key = util::Optional<std::string>;
+    static Key own(StringData string) { return string.is_null() ? Key() : Key(std::string(string)); }
+    static Key from_list(realm::List &list, size_t index) { return own(list.template get<StringData>(index)); }
+    template<typename Accessor, typename ValueType>
+    static Key from_value(Accessor &accessor, ValueType value) { return own(accessor.template unbox<StringData>(value)); }
+    static StringData value(const Key &key) { return key ? StringData(*key) : StringData(); }
+};
+
+template<>
+struct ListDiffKey<BinaryData> {
+    using Key = util::Optional<std::string>;
+    static Key own(BinaryData data) { return data.is_null() ? Key() : Key(std::string(data.data(), data.size())); }
+    static Key from_list(realm::List &list, size_t index) { return own(list.template get<BinaryData>(index)); }
+    template<typename Accessor, typename ValueType>
+    static Key from_value(Accessor &accessor, ValueType value) { return own(accessor.template unbox<BinaryData>(value)); }
+    static BinaryData value(const Key &key) { return key ? BinaryData(key->data(), key->size()) : BinaryData(); }
+};
+
+// Objects are compared by row, so objects with a primary key match the existing object they update.
+template<>
+struct ListDiffKey<RowExpr> {
+    using Key = size_t;
+    static Key from_list(realm::List &list, size_t index) { return list.get(index).get_index(); }
+    template<typename Accessor, typename ValueType>
+    static Key from_value(Accessor &accessor, ValueType value) { return accessor.template unbox<RowExpr>(value, true, true).get_index(); }
+    static size_t value(Key key) { return key; }
+};
+
+// The TypedArray types whose elements can be copied between lists of numbers and their buffers.
+struct TypedArrayType {
+    enum Element { Int8, Uint8, Uint8Clamped, Int16, Uint16, Int32, Uint32, Float32, Float64 };
+
+    const char *name;
+    Element element;
+    size_t element_size;
+
+    bool is_integral() const { return element != Float32 && element != Float64; }
+
+    static const TypedArrayType *find(const std::string &name) {
+        static const TypedArrayType types[] = {
+            {"Int8Array", Int8, 1},
+            {"Uint8Array", Uint8, 1},
+            {"Uint8ClampedArray", Uint8Clamped, 1},
+            {"Int16Array", Int16, 2},
+            {"Uint16Array", Uint16, 2},
+            {"Int32Array", Int32, 4},
+            {"Uint32Array", Uint32, 4},
+            {"Float32Array", Float32, 4},
+            {"Float64Array", Float64, 8},
+        };
+        for (auto &type : types) {
+            if (name == type.name) {
+                return &type;
+            }
+        }
+        return nullptr;
+    }
+
+    // Calls `fn` with each of the `count` elements in `bytes`, as an int64_t for integral types and
+    // as a float or double otherwise.
+    template<typename Fn>
+    void for_each(const char *bytes, size_t count, Fn &&fn) const {
+        switch (element) {
+            case Int8: return for_each_element<int8_t, int64_t>(bytes, count, fn);
+            case Uint8:
+            case Uint8Clamped: return for_each_element<uint8_t, int64_t>(bytes, count, fn);
+            case Int16: return for_each_element<int16_t, int64_t>(bytes, count, fn);
+            case Uint16: return for_each_element<uint16_t, int64_t>(bytes, count, fn);
+            case Int32: return for_each_element<int32_t, int64_t>(bytes, count, fn);
+            case Uint32: return for_each_element<uint32_t, int64_t>(bytes, count, fn);
+            case Float32: return for_each_element<float, float>(bytes, count, fn);
+            case Float64: return for_each_element<double, double>(bytes, count, fn);
+        }
+    }
+
+    // Stores `value` as element `index` of `bytes`, wrapping integers the way assigning them to the
+    // TypedArray would (or clamping them, for Uint8ClampedArray).
+    template<typename U>
+    void set(char *bytes, size_t index, U value) const {
+        switch (element) {
+            case Int8: return set_element<int8_t>(bytes, index, value);
+            case Uint8: return set_element<uint8_t>(bytes, index, value);
+            case Uint8Clamped: return set_element<uint8_t>(bytes, index, std::min<U>(std::max<U>(value, 0), 255));
+            case Int16: return set_element<int16_t>(bytes, index, value);
+            case Uint16: return set_element<uint16_t>(bytes, index, value);
+            case Int32: return set_element<int32_t>(bytes, index, value);
+            case Uint32: return set_element<uint32_t>(bytes, index, value);
+            case Float32: return set_element<float>(bytes, index, value);
+            case Float64: return set_element<double>(bytes, index, value);
+        }
+    }
+
+  private:
+    // The buffer of a TypedArray view need not be aligned for its element type, so elements are copied.
+    template<typename E, typename U, typename Fn>
+    static void for_each_element(const char *bytes, size_t count, Fn &fn) {
+        for (size_t i = 0; i < count; i++) {
+            E element;
+            memcpy(&element, bytes + i * sizeof(E), sizeof(E));
+            fn(U(element));
+        }
+    }
+
+    template<typename E, typename U>
+    static void set_element(char *bytes, size_t index, U value) {
+        E element = E(value);
+        memcpy(bytes + index * sizeof(E), &element, sizeof(E));
+    }
+};
+
+} // namespace _impl
+
 template<typename T>
 struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
     using Type = T;
@@ -50,7 +182,9 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
     using ObjectType = typename T::Object;
     using ValueType = typename T::Value;
     using FunctionType = typename T::Function;
+    using Function = js::Function<T>;
     using Object = js::Object<T>;
+    using String = js::String<T>;
     using Value = js::Value<T>;
     using ReturnValue = js::ReturnValue<T>;
     using Arguments = js::Arguments<T>;
@@ -70,9 +204,13 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
     static void unshift(ContextType, ObjectType, Arguments, ReturnValue &);
     static void shift(ContextType, ObjectType, Arguments, ReturnValue &);
     static void splice(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void assign(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void push_all(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void to_typed_array(ContextType, ObjectType, Arguments, ReturnValue &);
     static void snapshot(ContextType, ObjectType, Arguments, ReturnValue &);
     static void filtered(ContextType, ObjectType, Arguments, ReturnValue &);
     static void sorted(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void distinct(ContextType, ObjectType, Arguments, ReturnValue &);
     static void is_valid(ContextType, ObjectType, Arguments, ReturnValue &);
     static void index_of(ContextType, ObjectType, Arguments, ReturnValue &);
 
@@ -89,15 +227,22 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
         {"unshift", wrap<unshift>},
         {"shift", wrap<shift>},
         {"splice", wrap<splice>},
+        {"assign", wrap<assign>},
+        {"pushAll", wrap<push_all>},
+        {"toTypedArray", wrap<to_typed_array>},
         {"snapshot", wrap<snapshot>},
         {"filtered", wrap<filtered>},
         {"sorted", wrap<sorted>},
+        {"distinct", wrap<distinct>},
         {"isValid", wrap<is_valid>},
         {"indexOf", wrap<index_of>},
         {"min", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Max>>},
         {"sum", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Sum>>},
         {"avg", wrap<compute_aggregate_on_collection<ListClass<T>, AggregateFunc::Avg>>},
+        {"aggregate", wrap<compute_aggregates_on_collection<ListClass<T>>>},
+        {"_groupedAggregate", wrap<compute_grouped_aggregates_on_collection<ListClass<T>>>},
+        {"toJSON", wrap<serialize_collection<ListClass<T>>>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
@@ -113,6 +258,10 @@ struct ListClass : ClassDefinition<T, realm::js::List<T>, CollectionClass<T>> {
 
 private:
     static void validate_value(ContextType, realm::List&, ValueType);
+    static const _impl::TypedArrayType *get_typed_array_type(ContextType, ValueType);
+
+    template<typename U>
+    static void assign_diff(realm::List&, NativeAccessor<T>&, const std::vector<ValueType>&);
 };
 
 template<typename T>
@@ -248,6 +397,215 @@ void ListClass<T>::splice(ContextType ctx, ObjectType this_object, Arguments arg
     return_value.set(Object::create_array(ctx, removed_objects));
 }
 
+template<typename T>
+void ListClass<T>::assign(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_maximum(2);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    list->verify_in_transaction();
+
+    ObjectType array = Value::validated_to_array(ctx, args[0], "values");
+    uint32_t count = Object::validated_get_length(ctx, array);
+    std::vector<ValueType> values;
+    values.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        values.push_back(Object::get_property(ctx, array, i));
+        validate_value(ctx, *list, values.back());
+    }
+
+    bool diff = false;
+    if (!Value::is_undefined(ctx, args[1])) {
+        static const String diff_string = "diff";
+        ObjectType options = Value::validated_to_object(ctx, args[1], "options");
+        ValueType diff_value = Object::get_property(ctx, options, diff_string);
+        if (!Value::is_undefined(ctx, diff_value)) {
+            diff = Value::validated_to_boolean(ctx, diff_value, "diff");
+        }
+    }
+
+    NativeAccessor<T> accessor(ctx, *list);
+    if (!diff) {
+        list->remove_all();
+        for (auto &value : values) {
+            list->add(accessor, value);
+        }
+        return_value.set((uint32_t)list->size());
+        return;
+    }
+
+    bool nullable = is_nullable(list->get_type());
+    switch (list->get_type() & ~realm::PropertyType::Flags) {
+        case realm::PropertyType::Int:
+            nullable ? assign_diff<util::Optional<int64_t>>(*list, accessor, values) : assign_diff<int64_t>(*list, accessor, values);
+            break;
+        case realm::PropertyType::Bool:
+            nullable ? assign_diff<util::Optional<bool>>(*list, accessor, values) : assign_diff<bool>(*list, accessor, values);
+            break;
+        case realm::PropertyType::Float:
+            nullable ? assign_diff<util::Optional<float>>(*list, accessor, values) : assign_diff<float>(*list, accessor, values);
+            break;
+        case realm::PropertyType::Double:
+            nullable ? assign_diff<util::Optional<double>>(*list, accessor, values) : assign_diff<double>(*list, accessor, values);
+            break;
+        case realm::PropertyType::String:
+            assign_diff<StringData>(*list, accessor, values);
+            break;
+        case realm::PropertyType::Data:
+            assign_diff<BinaryData>(*list, accessor, values);
+            break;
+        case realm::PropertyType::Date:
+            assign_diff<Timestamp>(*list, accessor, values);
+            break;
+        case realm::PropertyType::Object:
+            assign_diff<RowExpr>(*list, accessor, values);
+            break;
+        default:
+            REALM_UNREACHABLE();
+    }
+    return_value.set((uint32_t)list->size());
+}
+
+template<typename T>
+template<typename U>
+void ListClass<T>::assign_diff(realm::List &list, NativeAccessor<T> &accessor, const std::vector<ValueType> &values) {
+    using DiffKey = _impl::ListDiffKey<U>;
+
+    std::vector<typename DiffKey::Key> from, to;
+    size_t size = list.size();
+    from.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        from.push_back(DiffKey::from_list(list, i));
+    }
+    to.reserve(values.size());
+    for (auto &value : values) {
+        to.push_back(DiffKey::from_value(accessor, value));
+    }
+
+    list_diff::apply(list_diff::compute(from, to),
+                     [&](size_t position) { list.remove(position); },
+                     [&](size_t position, size_t index) { list.insert(position, DiffKey::value(to[index])); },
+                     [&](size_t position, size_t index) { list.set(position, DiffKey::value(to[index])); });
+}
+
+template<typename T>
+void ListClass<T>::push_all(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    list->verify_in_transaction();
+
+    ValueType values = args[0];
+    if (Value::is_array(ctx, values)) {
+        ObjectType array = Value::to_array(ctx, values);
+        uint32_t count = Object::validated_get_length(ctx, array);
+        std::vector<ValueType> elements;
+        elements.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            elements.push_back(Object::get_property(ctx, array, i));
+            validate_value(ctx, *list, elements.back());
+        }
+
+        NativeAccessor<T> accessor(ctx, *list);
+        for (auto &element : elements) {
+            list->add(accessor, element);
+        }
+        return_value.set((uint32_t)list->size());
+        return;
+    }
+
+    auto typed_array_type = get_typed_array_type(ctx, values);
+    if (!typed_array_type) {
+        throw std::invalid_argument("values must be an array or a TypedArray.");
+    }
+
+    auto type = list->get_type() & ~realm::PropertyType::Flags;
+    if (type == realm::PropertyType::Int && !typed_array_type->is_integral()) {
+        throw std::invalid_argument(util::format("%1 elements cannot be added to a list of type 'int'.", typed_array_type->name));
+    }
+    if (type != realm::PropertyType::Int && type != realm::PropertyType::Float && type != realm::PropertyType::Double) {
+        throw std::invalid_argument(util::format("%1 elements cannot be added to a list of type '%2'.",
+                                                 typed_array_type->name, string_for_property_type(type)));
+    }
+
+    // The elements are read from the view's buffer in place and written to the rows of the list's
+    // table directly, rather than being boxed as JavaScript values or added one at a time through the
+    // List. The values of lists of primitives are in the first column of their table.
+    OwnedBinaryData storage;
+    BinaryData bytes = Value::typed_array_bytes(ctx, values, storage);
+    size_t count = bytes.size() / typed_array_type->element_size;
+    TableRef table = list->get_query().get_table();
+    size_t row = table->add_empty_row(count);
+    typed_array_type->for_each(bytes.data(), count, [&](auto element) {
+        switch (type) {
+            case realm::PropertyType::Int:
+                table->set_int(0, row++, int64_t(element));
+                break;
+            case realm::PropertyType::Float:
+                table->set_float(0, row++, float(element));
+                break;
+            default:
+                table->set_double(0, row++, double(element));
+                break;
+        }
+    });
+
+    return_value.set((uint32_t)list->size());
+}
+
+template<typename T>
+void ListClass<T>::to_typed_array(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_maximum(1);
+
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    auto type = list->get_type() & ~realm::PropertyType::Flags;
+    bool nullable = is_nullable(list->get_type());
+    if (type != realm::PropertyType::Int && type != realm::PropertyType::Float && type != realm::PropertyType::Double) {
+        throw std::invalid_argument(util::format("Lists of type '%1' cannot be converted to a TypedArray.", string_for_property_type(type)));
+    }
+
+    std::string name = type == realm::PropertyType::Float ? "Float32Array" : "Float64Array";
+    if (!Value::is_undefined(ctx, args[0])) {
+        name = Value::validated_to_string(ctx, args[0], "type");
+    }
+    auto typed_array_type = _impl::TypedArrayType::find(name);
+    if (!typed_array_type) {
+        throw std::invalid_argument(util::format("'%1' is not a supported TypedArray type.", name));
+    }
+    if (type != realm::PropertyType::Int && typed_array_type->is_integral()) {
+        throw std::invalid_argument(util::format("Lists of type '%1' cannot be converted to %2.", string_for_property_type(type), name));
+    }
+
+    size_t size = list->size();
+    std::vector<char> bytes(size * typed_array_type->element_size);
+    for (size_t i = 0; i < size; i++) {
+        switch (type) {
+            case realm::PropertyType::Int: {
+                auto value = nullable ? list->template get<util::Optional<int64_t>>(i) : list->template get<int64_t>(i);
+                if (!value) {
+                    throw std::invalid_argument(util::format("Lists containing null cannot be converted to %1.", name));
+                }
+                typed_array_type->set(bytes.data(), i, *value);
+                break;
+            }
+            case realm::PropertyType::Float: {
+                // Null elements become NaN.
+                auto value = nullable ? list->template get<util::Optional<float>>(i) : list->template get<float>(i);
+                typed_array_type->set(bytes.data(), i, value ? *value : std::numeric_limits<float>::quiet_NaN());
+                break;
+            }
+            default: {
+                auto value = nullable ? list->template get<util::Optional<double>>(i) : list->template get<double>(i);
+                typed_array_type->set(bytes.data(), i, value ? *value : std::numeric_limits<double>::quiet_NaN());
+                break;
+            }
+        }
+    }
+
+    ValueType buffer = Value::from_nonnull_binary(ctx, BinaryData(bytes.data(), bytes.size()));
+    FunctionType constructor = Value::validated_to_constructor(ctx, Object::get_global(ctx, typed_array_type->name), typed_array_type->name);
+    return_value.set(Function::construct(ctx, constructor, 1, &buffer));
+}
+
 template<typename T>
 void ListClass<T>::snapshot(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     args.validate_maximum(0);
@@ -267,6 +625,13 @@ void ListClass<T>::sorted(ContextType ctx, ObjectType this_object, Arguments arg
     return_value.set(ResultsClass<T>::create_instance(ctx, list->sort(ResultsClass<T>::get_keypaths(ctx, args))));
 }
 
+template<typename T>
+void ListClass<T>::distinct(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    auto list = get_internal<T, ListClass<T>>(this_object);
+    auto keypaths = ResultsClass<T>::get_distinct_keypaths(ctx, args);
+    return_value.set(ResultsClass<T>::create_instance(ctx, ResultsClass<T>::make_distinct(list->as_results(), keypaths)));
+}
+
 template<typename T>
 void ListClass<T>::is_valid(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     return_value.set(get_internal<T, ListClass<T>>(this_object)->is_valid());
@@ -313,5 +678,11 @@ void ListClass<T>::validate_value(ContextType ctx, realm::List& list, ValueType
     }
 }
 
+template<typename T>
+const _impl::TypedArrayType *ListClass<T>::get_typed_array_type(ContextType ctx, ValueType value) {
+    const char *name = Value::typed_array_type(ctx, value);
+    return name ? _impl::TypedArrayType::find(name) : nullptr;
+}
+
 } // js
 } // realm
@@ -18,14 +18,14 @@
 
 #pragma once
 
+#include <cmath>
+
+#include "base64.hpp"
+#include "iso8601.hpp"
 #include "js_list.hpp"
 #include "js_realm_object.hpp"
 #include "js_schema.hpp"
 
-#if REALM_ENABLE_SYNC
-#include <realm/util/base64.hpp>
-#endif
-
 namespace realm {
 class List;
 class Object;
@@ -51,19 +51,22 @@ public:
     using OptionalValue = util::Optional<ValueType>;
 
     NativeAccessor(ContextType ctx, std::shared_ptr<Realm> realm, const ObjectSchema& object_schema)
-    : m_ctx(ctx), m_realm(std::move(realm)), m_object_schema(&object_schema) { }
+    : m_ctx(ctx), m_realm(std::move(realm)), m_object_schema(&object_schema)
+    , m_representation(representation_for_realm(m_realm.get())) { }
 
     template<typename Collection>
     NativeAccessor(ContextType ctx, Collection const& collection)
     : m_ctx(ctx)
     , m_realm(collection.get_realm())
     , m_object_schema(collection.get_type() == realm::PropertyType::Object ? &collection.get_object_schema() : nullptr)
+    , m_representation(representation_for_realm(m_realm.get()))
     { }
 
     NativeAccessor(NativeAccessor& parent, const Property& prop)
     : m_ctx(parent.m_ctx)
     , m_realm(parent.m_realm)
     , m_object_schema(&*m_realm->schema().find(prop.object_type))
+    , m_representation(parent.m_representation)
     { }
 
     OptionalValue value_for_property(ValueType dict, std::string const& prop_name, size_t prop_index) {
@@ -97,19 +100,50 @@ public:
     ValueType box(util::Optional<T> v) { return v ? box(*v) : null_value(); }
 
     ValueType box(bool boolean)      { return Value::from_boolean(m_ctx, boolean); }
-    ValueType box(int64_t number)    { return Value::from_number(m_ctx, number); }
     ValueType box(float number)      { return Value::from_number(m_ctx, number); }
     ValueType box(double number)     { return Value::from_number(m_ctx, number); }
-    ValueType box(StringData string) { return Value::from_string(m_ctx, string.data()); }
+    ValueType box(StringData string) { return Value::from_string(m_ctx, string); }
     ValueType box(BinaryData data)   { return Value::from_binary(m_ctx, data); }
     ValueType box(Mixed)             { throw std::runtime_error("'Any' type is unsupported"); }
 
+    ValueType box(int64_t number) {
+        if (m_representation.integers == IntegerRepresentation::BigInt) {
+            return Value::from_bigint(m_ctx, number);
+        }
+        return Value::from_int64(m_ctx, number);
+    }
+
     ValueType box(Timestamp ts) {
         if (ts.is_null()) {
             return null_value();
         }
+        switch (m_representation.dates) {
+            case DateRepresentation::Milliseconds:
+                return Value::from_number(m_ctx, ts.get_seconds() * 1000.0 + ts.get_nanoseconds() / 1000000.0);
+            case DateRepresentation::SecondsNanoseconds:
+                return Object::create_array(m_ctx, {
+                    Value::from_number(m_ctx, ts.get_seconds()),
+                    Value::from_number(m_ctx, ts.get_nanoseconds())
+                });
+            case DateRepresentation::Date:
+                break;
+        }
         return Object::create_date(m_ctx, ts.get_seconds() * 1000 + ts.get_nanoseconds() / 1000000);
     }
+    // The result of min(), max(), sum() or avg(), in the representation used for property values.
+    ValueType box_aggregate(util::Optional<Mixed> value) {
+        if (!value) {
+            return Value::from_undefined(m_ctx);
+        }
+        switch (value->get_type()) {
+            case type_Int:
+                return box(value->get_int());
+            case type_Timestamp:
+                return box(value->get_timestamp());
+            default:
+                return Value::from_mixed(m_ctx, value);
+        }
+    }
     ValueType box(realm::Object realm_object) {
         return RealmObjectClass<JSEngine>::create_instance(m_ctx, std::move(realm_object));
     }
@@ -164,6 +198,13 @@ private:
     const ObjectSchema* m_object_schema;
     std::string m_string_buffer;
     OwnedBinaryData m_owned_binary_data;
+    ValueRepresentation m_representation;
+
+    static ValueRepresentation representation_for_realm(Realm* realm) {
+        // Realms opened internally (such as the old Realm during a migration) have no delegate.
+        auto delegate = get_delegate<JSEngine>(realm);
+        return delegate ? delegate->m_value_representation : ValueRepresentation();
+    }
 
     template<typename, typename>
     friend struct _impl::Unbox;
@@ -180,7 +221,13 @@ struct Unbox<JSEngine, bool> {
 template<typename JSEngine>
 struct Unbox<JSEngine, int64_t> {
     static int64_t call(NativeAccessor<JSEngine> *ctx, typename JSEngine::Value const& value, bool, bool) {
-        return js::Value<JSEngine>::validated_to_number(ctx->m_ctx, value, "Property");
+        if (js::Value<JSEngine>::is_bigint(ctx->m_ctx, value)) {
+            return js::Value<JSEngine>::to_bigint(ctx->m_ctx, value);
+        }
+        if (!js::Value<JSEngine>::is_number(ctx->m_ctx, value)) {
+            throw TypeErrorException("Property", "number", js::Value<JSEngine>::to_string(ctx->m_ctx, value));
+        }
+        return js::Value<JSEngine>::to_int64(ctx->m_ctx, value);
     }
 };
 
@@ -232,7 +279,10 @@ struct Unbox<JSEngine, StringData> {
         if (ctx->is_null(value)) {
             return StringData();
         }
-        ctx->m_string_buffer = js::Value<JSEngine>::validated_to_string(ctx->m_ctx, value, "Property");
+        if (!js::Value<JSEngine>::is_string(ctx->m_ctx, value)) {
+            throw TypeErrorException("Property", "string", js::Value<JSEngine>::to_string(ctx->m_ctx, value));
+        }
+        js::Value<JSEngine>::to_string(ctx->m_ctx, value, ctx->m_string_buffer);
         return ctx->m_string_buffer;
     }
 };
@@ -243,21 +293,17 @@ struct Unbox<JSEngine, BinaryData> {
         if (ctx->is_null(value)) {
             return BinaryData();
         }
-#if REALM_ENABLE_SYNC
-        // realm-sync holds the base64-decoding routine
         if (js::Value<JSEngine>::is_string(ctx->m_ctx, value)) {
             // the incoming value might be a base64 string, so let's try to parse it
             std::string str = js::Value<JSEngine>::to_string(ctx->m_ctx, value);
-            size_t max_size = util::base64_decoded_size(str.size());
-            std::unique_ptr<char[]> data(new char[max_size]);
-            if (auto size = util::base64_decode(str, data.get(), max_size)) {
-                ctx->m_owned_binary_data = OwnedBinaryData(std::move(data), *size);
-                return ctx->m_owned_binary_data.get();
-            } else {
+            std::unique_ptr<char[]> data(new char[base64::decoded_size(str.size())]);
+            size_t size = base64::decode(str.data(), str.size(), data.get());
+            if (size == base64::invalid) {
                 throw std::runtime_error("Attempting to populate BinaryData from string that is not valid base64");
             }
+            ctx->m_owned_binary_data = OwnedBinaryData(std::move(data), size);
+            return ctx->m_owned_binary_data.get();
         }
-#endif
 
         ctx->m_owned_binary_data = js::Value<JSEngine>::validated_to_binary(ctx->m_ctx, value);
         return ctx->m_owned_binary_data.get();
@@ -277,17 +323,64 @@ struct Unbox<JSEngine, Timestamp> {
         if (ctx->is_null(value)) {
             return Timestamp();
         }
+        if (js::Value<JSEngine>::is_number(ctx->m_ctx, value)) {
+            // milliseconds since the epoch, which may have a fractional part
+            double milliseconds = js::Value<JSEngine>::to_number(ctx->m_ctx, value);
+            if (!is_in_int64_range(milliseconds)) {
+                throw std::invalid_argument("Invalid date: milliseconds must be a finite number within range.");
+            }
+            return from_milliseconds(milliseconds);
+        }
+        if (js::Value<JSEngine>::is_array(ctx->m_ctx, value)) {
+            // a [seconds, nanoseconds] pair
+            auto pair = js::Value<JSEngine>::to_array(ctx->m_ctx, value);
+            if (js::Object<JSEngine>::validated_get_length(ctx->m_ctx, pair) != 2) {
+                throw std::invalid_argument("Date arrays must be [seconds, nanoseconds] pairs.");
+            }
+            auto seconds = js::Value<JSEngine>::validated_to_number(ctx->m_ctx, js::Object<JSEngine>::get_property(ctx->m_ctx, pair, 0), "seconds");
+            auto nanoseconds = js::Value<JSEngine>::validated_to_number(ctx->m_ctx, js::Object<JSEngine>::get_property(ctx->m_ctx, pair, 1), "nanoseconds");
+            if (!is_in_int64_range(seconds) || std::trunc(seconds) != seconds || std::trunc(nanoseconds) != nanoseconds) {
+                throw std::invalid_argument("Seconds and nanoseconds of a date must be integers, and seconds within range.");
+            }
+            if (std::abs(nanoseconds) >= 1000000000 || (seconds > 0 && nanoseconds < 0) || (seconds < 0 && nanoseconds > 0)) {
+                throw std::invalid_argument("Nanoseconds must be less than one second and have the same sign as seconds.");
+            }
+            return Timestamp(seconds, nanoseconds);
+        }
+
         typename JSEngine::Value date;
         if (js::Value<JSEngine>::is_string(ctx->m_ctx, value)) {
-            // the incoming value might be a date string, so let the Date constructor have at it
+            // ISO-8601 strings are parsed natively, which keeps their full precision
+            js::Value<JSEngine>::to_string(ctx->m_ctx, value, ctx->m_string_buffer);
+            iso8601::Timestamp timestamp;
+            if (iso8601::parse(ctx->m_string_buffer.data(), ctx->m_string_buffer.size(), timestamp)) {
+                return Timestamp(timestamp.seconds, timestamp.nanoseconds);
+            }
+            // any other date string is left to the Date constructor
             date = js::Value<JSEngine>::to_date(ctx->m_ctx, value);
         } else {
             date = js::Value<JSEngine>::validated_to_date(ctx->m_ctx, value);
         }
-
         double milliseconds = js::Value<JSEngine>::to_number(ctx->m_ctx, date);
+        if (std::isnan(milliseconds)) {
+            throw std::invalid_argument("Invalid date");
+        }
+        return from_milliseconds(milliseconds);
+    }
+
+    // False for NaN and infinities as well, which mustn't be converted to integers either.
+    static bool is_in_int64_range(double value) {
+        return value >= -9223372036854775808.0 && value < 9223372036854775808.0;
+    }
+
+    static Timestamp from_milliseconds(double milliseconds) {
         int64_t seconds = milliseconds / 1000;
-        int32_t nanoseconds = ((int64_t)milliseconds % 1000) * 1000000;
+        int32_t nanoseconds = std::round((milliseconds - seconds * 1000.0) * 1000000);
+        if (nanoseconds >= 1000000000 || nanoseconds <= -1000000000) {
+            // rounding carried into the next second
+            seconds += nanoseconds / 1000000000;
+            nanoseconds %= 1000000000;
+        }
         return Timestamp(seconds, nanoseconds);
     }
 };
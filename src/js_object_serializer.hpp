@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "js_types.hpp"
+#include "js_util.hpp"
+
+#include "list.hpp"
+#include "object_schema.hpp"
+#include "property.hpp"
+#include "shared_realm.hpp"
+
+namespace realm {
+namespace js {
+
+template<typename>
+class NativeAccessor;
+
+// Converts Realm objects, and the objects they link to, into plain JavaScript objects and arrays in a
+// single native pass. Links are followed up to `depth` levels deep and, if `include` is given, only
+// along the key paths it lists. A link which isn't followed, or which leads back to an object that is
+// still being converted (a cycle), becomes the primary key of the linked object, or null if its type
+// has no primary key. Since where cycles are cut depends on the path to an object, an object is only
+// converted once and shared when it is reached several times with the same remaining depth from one
+// conversion of its parent, or as several of the root objects.
+template<typename T>
+class ObjectSerializer {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using String = js::String<T>;
+    using Object = js::Object<T>;
+    using Value = js::Value<T>;
+
+  public:
+    ObjectSerializer(ContextType ctx, SharedRealm realm, const ObjectSchema &object_schema, ValueType options)
+    : m_ctx(ctx), m_realm(std::move(realm)), m_accessor(ctx, m_realm, object_schema) {
+        // JSON.stringify() calls toJSON() with the name of the property being serialized.
+        if (!Value::is_object(ctx, options)) {
+            return;
+        }
+        ObjectType options_object = Value::to_object(ctx, options);
+
+        static const String depth_string = "depth";
+        ValueType depth_value = Object::get_property(ctx, options_object, depth_string);
+        if (!Value::is_undefined(ctx, depth_value)) {
+            double depth = Value::validated_to_number(ctx, depth_value, "depth");
+            if (!(depth >= 0)) {
+                throw std::invalid_argument("depth must be a non-negative number.");
+            }
+            m_depth = depth >= double(unlimited) ? unlimited : size_t(depth);
+        }
+
+        static const String include_string = "include";
+        ValueType include_value = Object::get_property(ctx, options_object, include_string);
+        if (!Value::is_undefined(ctx, include_value)) {
+            ObjectType paths = Value::validated_to_array(ctx, include_value, "include");
+            uint32_t count = Object::validated_get_length(ctx, paths);
+            for (uint32_t i = 0; i < count; i++) {
+                add_include(object_schema, Object::validated_get_string(ctx, paths, i));
+            }
+            m_has_include = true;
+        }
+    }
+
+    ValueType serialize(const ObjectSchema &object_schema, RowExpr row) {
+        return serialize_object(object_schema, row, m_depth, m_has_include ? &m_include : nullptr);
+    }
+
+  private:
+    static constexpr size_t unlimited = size_t(-1);
+
+    // The links named by `include`, as a tree of property names.
+    struct IncludeNode {
+        std::map<std::string, IncludeNode> children;
+    };
+
+    using Identity = std::pair<const Table *, size_t>;
+
+    ContextType m_ctx;
+    SharedRealm m_realm;
+    NativeAccessor<T> m_accessor;
+    size_t m_depth = unlimited;
+    bool m_has_include = false;
+    IncludeNode m_include;
+
+    std::set<Identity> m_path;
+    // The number of the conversion in progress, which stands for the path to the objects it reaches,
+    // or 0 for the root objects. Converted objects are only shared by conversions with the same path.
+    size_t m_conversion = 0;
+    size_t m_conversion_count = 0;
+    std::map<std::tuple<const Table *, size_t, size_t, const IncludeNode *, size_t>, ObjectType> m_converted;
+
+    void add_include(const ObjectSchema &root_object_schema, const std::string &path) {
+        const ObjectSchema *object_schema = &root_object_schema;
+        IncludeNode *node = &m_include;
+        size_t start = 0;
+        while (true) {
+            size_t end = path.find('.', start);
+            std::string name = path.substr(start, end == std::string::npos ? end : end - start);
+            const Property *property = object_schema->property_for_name(name);
+            if (!property || (property->type & ~PropertyType::Flags) != PropertyType::Object) {
+                throw std::invalid_argument(util::format("Invalid key path '%1' in 'include': '%2.%3' is not a link.",
+                                                         path, object_schema->name, name));
+            }
+
+            node = &node->children[name];
+            if (end == std::string::npos) {
+                return;
+            }
+            object_schema = &*m_realm->schema().find(property->object_type);
+            start = end + 1;
+        }
+    }
+
+    ValueType serialize_object(const ObjectSchema &object_schema, RowExpr row, size_t depth, const IncludeNode *include) {
+        Identity identity(row.get_table(), row.get_index());
+        auto key = std::make_tuple(identity.first, identity.second, depth, include, m_conversion);
+        auto converted = m_converted.find(key);
+        if (converted != m_converted.end()) {
+            return converted->second;
+        }
+
+        ObjectType object = Object::create_empty(m_ctx);
+        size_t parent_conversion = m_conversion;
+        m_conversion = ++m_conversion_count;
+        m_path.insert(identity);
+        for (auto &property : object_schema.persisted_properties) {
+            Object::set_property(m_ctx, object, property.name, property_value(property, row, depth, include));
+        }
+        m_path.erase(identity);
+        m_conversion = parent_conversion;
+
+        m_converted.emplace(key, object);
+        return object;
+    }
+
+    ValueType property_value(const Property &property, RowExpr row, size_t depth, const IncludeNode *include) {
+        size_t column = property.table_column;
+        if ((property.type & ~PropertyType::Flags) != PropertyType::Object) {
+            if (!is_array(property.type)) {
+                return primitive_value(property, row);
+            }
+
+            realm::List list(m_realm, *row.get_table(), column, row.get_index());
+            size_t size = list.size();
+            std::vector<ValueType> values;
+            values.reserve(size);
+            for (size_t i = 0; i < size; i++) {
+                values.push_back(list.get(m_accessor, i));
+            }
+            return Object::create_array(m_ctx, values);
+        }
+
+        const IncludeNode *child = nullptr;
+        bool follow = depth > 0;
+        if (include) {
+            auto it = include->children.find(property.name);
+            child = it != include->children.end() ? &it->second : nullptr;
+            follow = follow && child;
+        }
+        size_t child_depth = depth == unlimited ? depth : depth - 1;
+        auto &target_object_schema = *m_realm->schema().find(property.object_type);
+
+        auto link_value = [&](RowExpr target) {
+            if (follow && !m_path.count(Identity(target.get_table(), target.get_index()))) {
+                return serialize_object(target_object_schema, target, child_depth, child);
+            }
+            if (auto primary_key = target_object_schema.primary_key_property()) {
+                return primitive_value(*primary_key, target);
+            }
+            return Value::from_null(m_ctx);
+        };
+
+        if (!is_array(property.type)) {
+            if (row.is_null_link(column)) {
+                return Value::from_null(m_ctx);
+            }
+            return link_value(row.get_table()->get_link_target(column)->get(row.get_link(column)));
+        }
+
+        LinkViewRef link_view = row.get_linklist(column);
+        size_t size = link_view->size();
+        std::vector<ValueType> values;
+        values.reserve(size);
+        for (size_t i = 0; i < size; i++) {
+            values.push_back(link_value(link_view->get(i)));
+        }
+        return Object::create_array(m_ctx, values);
+    }
+
+    ValueType primitive_value(const Property &property, RowExpr row) {
+        size_t column = property.table_column;
+        if (is_nullable(property.type) && row.is_null(column)) {
+            return Value::from_null(m_ctx);
+        }
+
+        switch (property.type & ~PropertyType::Flags) {
+            case PropertyType::Bool:
+                return m_accessor.box(row.get_bool(column));
+            case PropertyType::Int:
+                return m_accessor.box(row.get_int(column));
+            case PropertyType::Float:
+                return m_accessor.box(row.get_float(column));
+            case PropertyType::Double:
+                return m_accessor.box(row.get_double(column));
+            case PropertyType::String:
+                return m_accessor.box(row.get_string(column));
+            case PropertyType::Data:
+                return m_accessor.box(row.get_binary(column));
+            case PropertyType::Date:
+                return m_accessor.box(row.get_timestamp(column));
+            default:
+                REALM_UNREACHABLE();
+        }
+    }
+};
+
+template<typename T>
+void serialize_collection(typename T::ContextType ctx, typename T::ObjectType this_object,
+                          typename T::Arguments args, typename T::ReturnValue &return_value) {
+    using Type = typename T::Type;
+
+    args.validate_maximum(1);
+    auto collection = get_internal<Type, T>(this_object);
+
+    size_t size = collection->size();
+    std::vector<typename Type::Value> values;
+    values.reserve(size);
+    if (collection->get_type() == realm::PropertyType::Object) {
+        auto &object_schema = collection->get_object_schema();
+        ObjectSerializer<Type> serializer(ctx, collection->get_realm(), object_schema, args[0]);
+        for (size_t i = 0; i < size; i++) {
+            values.push_back(serializer.serialize(object_schema, collection->get(i)));
+        }
+    }
+    else {
+        NativeAccessor<Type> accessor(ctx, *collection);
+        for (size_t i = 0; i < size; i++) {
+            values.push_back(collection->get(accessor, i));
+        }
+    }
+    return_value.set(js::Object<Type>::create_array(ctx, values));
+}
+
+} // js
+} // realm
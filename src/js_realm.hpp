@@ -19,9 +19,12 @@
 #pragma once
 
 #include <cctype>
+#include <cmath>
 #include <list>
 #include <map>
+#include <unordered_map>
 
+#include "full_text_index.hpp"
 #include "js_class.hpp"
 #include "js_types.hpp"
 #include "js_util.hpp"
@@ -30,6 +33,7 @@
 #include "js_results.hpp"
 #include "js_schema.hpp"
 #include "js_observable.hpp"
+#include "js_thread_safe_reference.hpp"
 
 #if REALM_ENABLE_SYNC
 #include "js_sync.hpp"
@@ -77,8 +81,10 @@ class RealmDelegate : public BindingContext {
 
     using ObjectDefaultsMap = typename Schema<T>::ObjectDefaultsMap;
     using ConstructorMap = typename Schema<T>::ConstructorMap;
+    using FullTextIndexedMap = typename Schema<T>::FullTextIndexedMap;
 
     virtual void did_change(std::vector<ObserverState> const& observers, std::vector<void*> const& invalidated, bool version_changed) {
+        update_full_text_indexes();
         notify("change");
     }
 
@@ -89,6 +95,7 @@ class RealmDelegate : public BindingContext {
         m_defaults.clear();
         m_constructors.clear();
         m_notifications.clear();
+        m_views.clear();
     }
 
     void add_notification(FunctionType notification) {
@@ -113,12 +120,75 @@ class RealmDelegate : public BindingContext {
 
     ObjectDefaultsMap m_defaults;
     ConstructorMap m_constructors;
+    ValueRepresentation m_value_representation;
+
+    // Where linkingObjects() finds the links of an (object type, property) pair, keyed by the type and
+    // property name separated by a null character. The indexes are checked against the current schema
+    // when used, as the schema may change while the Realm is open.
+    struct BacklinkSource {
+        size_t object_schema_index;
+        size_t property_index;
+        TableRef table;
+    };
+    std::unordered_map<std::string, BacklinkSource> m_backlink_sources;
+
+    // The token indexes of the string properties searched with search(), keyed like
+    // m_backlink_sources. The indexes of the properties declared with `fullTextIndexed: true` by any
+    // schema the Realm was opened with are kept up to date as changes are committed or received, the
+    // others are only brought up to date by search().
+    FullTextIndexedMap m_full_text_indexed;
+    struct FullTextIndex {
+        TableRef table;
+        size_t column;
+        full_text::Index index;
+    };
+    std::unordered_map<std::string, FullTextIndex> m_full_text_indexes;
+
+    full_text::Index &full_text_index(realm::Realm &realm, const ObjectSchema &object_schema, const Property &property) {
+        auto &entry = m_full_text_indexes[object_schema.name + '\0' + property.name];
+        TableRef table = ObjectStore::table_for_object_type(realm.read_group(), object_schema.name);
+        if (entry.table != table || entry.column != property.table_column) {
+            entry.table = table;
+            entry.column = property.table_column;
+            entry.index = full_text::Index();
+        }
+        entry.index.update(*table, entry.column);
+        return entry.index;
+    }
+
+    // The Results defined with defineView(), by name. Each one is observed for as long as it is
+    // defined, so that the notifier keeps re-running its query in the background and hands the
+    // updated rows over, and opening the view neither creates a collection nor runs the query.
+    // As the Results hold the Realm, they are only released by removeView() or by closing it.
+    struct View {
+        Protected<ObjectType> results;
+        NotificationToken token;
+    };
+    std::map<std::string, View> m_views;
 
   private:
     Protected<GlobalContextType> m_context;
     std::list<Protected<FunctionType>> m_notifications;
     std::weak_ptr<realm::Realm> m_realm;
 
+    void update_full_text_indexes() {
+        SharedRealm realm = m_realm.lock();
+        if (m_full_text_indexed.empty() || !realm || realm->is_closed()) {
+            return;
+        }
+        for (auto &indexed : m_full_text_indexed) {
+            auto object_schema = realm->schema().find(indexed.first);
+            if (object_schema == realm->schema().end()) {
+                continue;
+            }
+            for (auto &property_name : indexed.second) {
+                if (const Property *property = object_schema->property_for_name(property_name)) {
+                    full_text_index(*realm, *object_schema, *property);
+                }
+            }
+        }
+    }
+
     void notify(const char *notification_name) {
         HANDLESCOPE
 
@@ -161,6 +231,7 @@ class RealmClass : public ClassDefinition<T, SharedRealm, ObservableClass<T>> {
 public:
     using ObjectDefaultsMap = typename Schema<T>::ObjectDefaultsMap;
     using ConstructorMap = typename Schema<T>::ConstructorMap;
+    using FullTextIndexedMap = typename Schema<T>::FullTextIndexedMap;
 
     using WaitHandler = void(std::error_code);
     using ProgressHandler = void(uint64_t transferred_bytes, uint64_t transferrable_bytes);
@@ -171,9 +242,18 @@ public:
     // methods
     static void objects(ContextType, ObjectType, Arguments, ReturnValue &);
     static void object_for_primary_key(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void objects_for_primary_keys(ContextType, ObjectType, Arguments, ReturnValue &);
     static void create(ContextType, ObjectType, Arguments, ReturnValue &);
     static void delete_one(ContextType, ObjectType, Arguments, ReturnValue &);
     static void delete_all(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void delete_where(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void count(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void exists(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void define_view(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void view(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void remove_view(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void obtain_thread_safe_reference(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void resolve_thread_safe_reference(ContextType, ObjectType, Arguments, ReturnValue &);
     static void write(ContextType, ObjectType, Arguments, ReturnValue &);
     static void begin_transaction(ContextType, ObjectType, Arguments, ReturnValue&);
     static void commit_transaction(ContextType, ObjectType, Arguments, ReturnValue&);
@@ -205,7 +285,8 @@ public:
 
     // static methods
     static void constructor(ContextType, ObjectType, size_t, const ValueType[]);
-    static SharedRealm create_shared_realm(ContextType, realm::Realm::Config, bool, ObjectDefaultsMap &&, ConstructorMap &&);
+    static SharedRealm create_shared_realm(ContextType, realm::Realm::Config, bool, ObjectDefaultsMap &&, ConstructorMap &&,
+                                           FullTextIndexedMap &&, const ValueRepresentation &);
 
     static void schema_version(ContextType, ObjectType, Arguments, ReturnValue &);
     static void clear_test_state(ContextType, ObjectType, Arguments, ReturnValue &);
@@ -232,9 +313,18 @@ public:
     MethodMap<T> const methods = {
         {"objects", wrap<objects>},
         {"objectForPrimaryKey", wrap<object_for_primary_key>},
+        {"objectsForPrimaryKeys", wrap<objects_for_primary_keys>},
         {"create", wrap<create>},
         {"delete", wrap<delete_one>},
         {"deleteAll", wrap<delete_all>},
+        {"deleteWhere", wrap<delete_where>},
+        {"count", wrap<count>},
+        {"exists", wrap<exists>},
+        {"defineView", wrap<define_view>},
+        {"view", wrap<view>},
+        {"removeView", wrap<remove_view>},
+        {"obtainThreadSafeReference", wrap<obtain_thread_safe_reference>},
+        {"resolveThreadSafeReference", wrap<resolve_thread_safe_reference>},
         {"write", wrap<write>},
         {"beginTransaction", wrap<begin_transaction>},
         {"commitTransaction", wrap<commit_transaction>},
@@ -287,6 +377,25 @@ public:
         }
     }
 
+    // Builds the query given by the predicate in args[1] and its arguments straight on the table for
+    // the type in args[0], without creating a Results for it. Without a predicate, all rows match.
+    static Query table_query(ContextType ctx, const SharedRealm &realm, Arguments &args) {
+        std::string object_type;
+        auto &object_schema = validated_object_schema_for_value(ctx, realm, args[0], object_type);
+        auto table = ObjectStore::table_for_object_type(realm->read_group(), object_type);
+        auto query = table->where();
+        if (args.count < 2) {
+            return query;
+        }
+
+        auto query_string = Value::validated_to_string(ctx, args[1], "predicate");
+        parser::Predicate predicate = parser::parse(query_string);
+        NativeAccessor accessor(ctx, realm, object_schema);
+        query_builder::ArgumentConverter<ValueType, NativeAccessor> converter(accessor, &args.value[2], args.count - 2);
+        query_builder::apply_predicate(query, predicate, converter);
+        return query;
+    }
+
     static std::string validated_notification_name(ContextType ctx, const ValueType &value) {
         std::string name = Value::validated_to_string(ctx, value, "notification name");
         if (name != "change") {
@@ -326,6 +435,36 @@ public:
         }
         return *object_schema;
     }
+
+    // Support for `create(type, properties, {update: 'modified'})`, which only writes changed values.
+    static realm::Object create_modified(ContextType, NativeAccessor &, const SharedRealm &, const ObjectSchema &, ObjectType);
+    static bool is_unchanged(ContextType, NativeAccessor &, realm::Object &, const Property &, ValueType);
+    template<typename U>
+    static bool list_is_unchanged(ContextType, NativeAccessor &, realm::List &, ObjectType);
+
+    static bool is_link(realm::PropertyType type) {
+        return !realm::is_array(type) && (type & ~realm::PropertyType::Flags) == realm::PropertyType::Object;
+    }
+    static bool is_link_list(realm::PropertyType type) {
+        return realm::is_array(type) && (type & ~realm::PropertyType::Flags) == realm::PropertyType::Object;
+    }
+
+    // Whether a stored value is the same as a new one. NaN is the same as NaN, so that it doesn't count
+    // as a modification.
+    template<typename U>
+    static bool is_same_value(const U &a, const U &b) {
+        return a == b;
+    }
+    static bool is_same_value(float a, float b) {
+        return a == b || (std::isnan(a) && std::isnan(b));
+    }
+    static bool is_same_value(double a, double b) {
+        return a == b || (std::isnan(a) && std::isnan(b));
+    }
+    template<typename U>
+    static bool is_same_value(const util::Optional<U> &a, const util::Optional<U> &b) {
+        return a && b ? is_same_value(*a, *b) : !a && !b;
+    }
 };
 
 template<typename T>
@@ -335,12 +474,14 @@ inline typename T::Function RealmClass<T>::create_constructor(ContextType ctx) {
     FunctionType list_constructor = ObjectWrap<T, ListClass<T>>::create_constructor(ctx);
     FunctionType results_constructor = ObjectWrap<T, ResultsClass<T>>::create_constructor(ctx);
     FunctionType realm_object_constructor = ObjectWrap<T, RealmObjectClass<T>>::create_constructor(ctx);
+    FunctionType thread_safe_reference_constructor = ObjectWrap<T, ThreadSafeReferenceClass<T>>::create_constructor(ctx);
 
     PropertyAttributes attributes = ReadOnly | DontEnum | DontDelete;
     Object::set_property(ctx, realm_constructor, "Collection", collection_constructor, attributes);
     Object::set_property(ctx, realm_constructor, "List", list_constructor, attributes);
     Object::set_property(ctx, realm_constructor, "Results", results_constructor, attributes);
     Object::set_property(ctx, realm_constructor, "Object", realm_object_constructor, attributes);
+    Object::set_property(ctx, realm_constructor, "ThreadSafeReference", thread_safe_reference_constructor, attributes);
 
 #if REALM_ENABLE_SYNC
     FunctionType sync_constructor = SyncClass<T>::create_constructor(ctx);
@@ -388,6 +529,8 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
     realm::Realm::Config config;
     ObjectDefaultsMap defaults;
     ConstructorMap constructors;
+    FullTextIndexedMap full_text_indexed;
+    ValueRepresentation value_representation;
     bool schema_updated = false;
 
     if (argc == 0) {
@@ -447,7 +590,7 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
             ValueType schema_value = Object::get_property(ctx, object, schema_string);
             if (!Value::is_undefined(ctx, schema_value)) {
                 ObjectType schema_object = Value::validated_to_array(ctx, schema_value, "schema");
-                config.schema.emplace(Schema<T>::parse_schema(ctx, schema_object, defaults, constructors));
+                config.schema.emplace(Schema<T>::parse_schema(ctx, schema_object, defaults, constructors, full_text_indexed));
                 schema_updated = true;
             }
 
@@ -526,6 +669,41 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
             if (!Value::is_undefined(ctx, disable_format_upgrade_value)) {
                 config.disable_format_upgrade = Value::validated_to_boolean(ctx, disable_format_upgrade_value, "disableFormatUpgrade");
             }
+
+            static const String date_representation_string = "dateRepresentation";
+            ValueType date_representation_value = Object::get_property(ctx, object, date_representation_string);
+            if (!Value::is_undefined(ctx, date_representation_value)) {
+                std::string representation = Value::validated_to_string(ctx, date_representation_value, "dateRepresentation");
+                if (representation == "date") {
+                    value_representation.dates = DateRepresentation::Date;
+                }
+                else if (representation == "milliseconds") {
+                    value_representation.dates = DateRepresentation::Milliseconds;
+                }
+                else if (representation == "secondsNanoseconds") {
+                    value_representation.dates = DateRepresentation::SecondsNanoseconds;
+                }
+                else {
+                    throw std::invalid_argument(util::format("Unknown dateRepresentation '%1': expected 'date', 'milliseconds' or 'secondsNanoseconds'.", representation));
+                }
+            }
+
+            static const String integer_representation_string = "integerRepresentation";
+            ValueType integer_representation_value = Object::get_property(ctx, object, integer_representation_string);
+            if (!Value::is_undefined(ctx, integer_representation_value)) {
+                std::string representation = Value::validated_to_string(ctx, integer_representation_value, "integerRepresentation");
+                if (representation == "number") {
+                    value_representation.integers = IntegerRepresentation::Number;
+                }
+                else if (representation == "bigint") {
+                    // Fail here rather than on the first read if the engine has no BigInt.
+                    Value::from_bigint(ctx, 0);
+                    value_representation.integers = IntegerRepresentation::BigInt;
+                }
+                else {
+                    throw std::invalid_argument(util::format("Unknown integerRepresentation '%1': expected 'number' or 'bigint'.", representation));
+                }
+            }
         }
     }
     else {
@@ -535,7 +713,8 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
     config.path = normalize_realm_path(config.path);
     ensure_directory_exists_for_file(config.path);
 
-    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors));
+    auto realm = create_shared_realm(ctx, config, schema_updated, std::move(defaults), std::move(constructors),
+                                     std::move(full_text_indexed), value_representation);
 
     // Fix for datetime -> timestamp conversion
     convert_outdated_datetime_columns(realm);
@@ -545,9 +724,17 @@ void RealmClass<T>::constructor(ContextType ctx, ObjectType this_object, size_t
 
 template<typename T>
 SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Config config, bool schema_updated,
-                                        ObjectDefaultsMap && defaults, ConstructorMap && constructors) {
+                                        ObjectDefaultsMap && defaults, ConstructorMap && constructors,
+                                        FullTextIndexedMap && full_text_indexed, const ValueRepresentation &value_representation) {
     config.execution_context = Context<T>::get_execution_context_id(ctx);
 
+    // A Realm opened where notifications can't be delivered mustn't be signalled either, as the signal
+    // would make another thread advance it and call into this context.
+    bool supports_notifications = Context<T>::supports_notifications(ctx);
+    if (!supports_notifications) {
+        config.automatic_change_notifications = false;
+    }
+
     SharedRealm realm;
     try {
         realm = realm::Realm::get_shared_realm(config);
@@ -559,8 +746,13 @@ SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Co
         throw;
     }
 
+    if (!supports_notifications) {
+        realm->set_auto_refresh(false);
+    }
+
     GlobalContextType global_context = Context<T>::get_global_context(ctx);
-    if (!realm->m_binding_context) {
+    bool new_binding_context = !realm->m_binding_context;
+    if (new_binding_context) {
         realm->m_binding_context.reset(new RealmDelegate<T>(realm, global_context));
     }
 
@@ -568,12 +760,30 @@ SharedRealm RealmClass<T>::create_shared_realm(ContextType ctx, realm::Realm::Co
     REALM_ASSERT(js_binding_context);
     REALM_ASSERT(js_binding_context->m_context == global_context);
 
+    // The representation is shared by every instance of a cached Realm, so it can't be changed by
+    // opening the Realm again.
+    if (new_binding_context) {
+        js_binding_context->m_value_representation = value_representation;
+    }
+    else if (js_binding_context->m_value_representation.dates != value_representation.dates) {
+        throw std::invalid_argument(util::format("Realm at path '%1' is already open with a different dateRepresentation.", config.path));
+    }
+    else if (js_binding_context->m_value_representation.integers != value_representation.integers) {
+        throw std::invalid_argument(util::format("Realm at path '%1' is already open with a different integerRepresentation.", config.path));
+    }
+
     // If a new schema was provided, then use its defaults and constructors.
     if (schema_updated) {
         js_binding_context->m_defaults = std::move(defaults);
         js_binding_context->m_constructors = std::move(constructors);
     }
 
+    // Properties stay full-text indexed when the Realm is opened again with a schema which doesn't
+    // declare them, as long as they exist.
+    for (auto &indexed : full_text_indexed) {
+        js_binding_context->m_full_text_indexed[indexed.first].insert(indexed.second.begin(), indexed.second.end());
+    }
+
     return realm;
 }
 
@@ -818,6 +1028,60 @@ void RealmClass<T>::object_for_primary_key(ContextType ctx, ObjectType this_obje
     }
 }
 
+template<typename T>
+void RealmClass<T>::objects_for_primary_keys(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(2);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    std::string object_type;
+    auto &object_schema = validated_object_schema_for_value(ctx, realm, args[0], object_type);
+    auto primary_prop = object_schema.primary_key_property();
+    if (!primary_prop) {
+        throw MissingPrimaryKeyException(object_schema.name);
+    }
+
+    ObjectType keys = Value::validated_to_array(ctx, args[1], "keys");
+    uint32_t count = Object::validated_get_length(ctx, keys);
+    std::vector<ValueType> objects;
+    objects.reserve(count);
+
+    // Resolve the table and key column once and do all the lookups in this loop.
+    auto table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+    size_t column = primary_prop->table_column;
+    bool nullable = is_nullable(primary_prop->type);
+    NativeAccessor accessor(ctx, realm, object_schema);
+
+    for (uint32_t i = 0; i < count; i++) {
+        ValueType key = Object::get_property(ctx, keys, i);
+        if (!nullable && accessor.is_null(key)) {
+            throw std::logic_error("Invalid null value for non-nullable primary key.");
+        }
+
+        size_t row_index = realm::not_found;
+        if (!table) {
+            // The type has no table yet, so every key is a miss.
+        }
+        else if ((primary_prop->type & ~realm::PropertyType::Flags) == realm::PropertyType::String) {
+            row_index = table->find_first(column, accessor.template unbox<StringData>(key));
+        }
+        else if (nullable) {
+            row_index = table->find_first(column, accessor.template unbox<util::Optional<int64_t>>(key));
+        }
+        else {
+            row_index = table->find_first(column, accessor.template unbox<int64_t>(key));
+        }
+
+        if (row_index == realm::not_found) {
+            objects.push_back(Value::from_undefined(ctx));
+        }
+        else {
+            objects.push_back(RealmObjectClass<T>::create_instance(ctx, realm::Object(realm, object_schema, table->get(row_index))));
+        }
+    }
+
+    return_value.set(Object::create_array(ctx, objects));
+}
+
 template<typename T>
 void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     args.validate_maximum(3);
@@ -833,15 +1097,225 @@ void RealmClass<T>::create(ContextType ctx, ObjectType this_object, Arguments ar
     }
 
     bool update = false;
-    if (args.count == 3) {
+    bool update_modified = false;
+    if (args.count == 3 && Value::is_object(ctx, args[2])) {
+        ObjectType options = Value::to_object(ctx, args[2]);
+        static const String update_string = "update";
+        ValueType update_value = Object::get_property(ctx, options, update_string);
+        if (Value::is_string(ctx, update_value)) {
+            std::string mode = Value::to_string(ctx, update_value);
+            if (mode == "modified") {
+                update = update_modified = true;
+            }
+            else if (mode == "all") {
+                update = true;
+            }
+            else {
+                throw std::invalid_argument(util::format("Unknown update mode '%1': expected 'all' or 'modified'.", mode));
+            }
+        }
+        else if (!Value::is_undefined(ctx, update_value)) {
+            update = Value::validated_to_boolean(ctx, update_value, "update");
+        }
+    }
+    else if (args.count == 3) {
         update = Value::validated_to_boolean(ctx, args[2], "update");
     }
 
     NativeAccessor accessor(ctx, realm, object_schema);
+    if (update_modified) {
+        return_value.set(RealmObjectClass<T>::create_instance(ctx, create_modified(ctx, accessor, realm, object_schema, object)));
+        return;
+    }
     auto realm_object = realm::Object::create<ValueType>(accessor, realm, object_schema, object, update);
     return_value.set(RealmObjectClass<T>::create_instance(ctx, std::move(realm_object)));
 }
 
+template<typename T>
+realm::Object RealmClass<T>::create_modified(ContextType ctx, NativeAccessor &accessor, const SharedRealm &realm,
+                                             const ObjectSchema &object_schema, ObjectType object) {
+    // Checked here since an update which changes nothing never reaches Object::create().
+    realm->verify_in_write();
+
+    // New objects (and types without primary keys, which can't be updated) take the normal path.
+    auto primary_prop = object_schema.primary_key_property();
+    if (!primary_prop) {
+        return realm::Object::create<ValueType>(accessor, realm, object_schema, object, true);
+    }
+    auto primary_value = accessor.value_for_property(object, primary_prop->name, primary_prop - &object_schema.persisted_properties[0]);
+    if (!primary_value) {
+        return realm::Object::create<ValueType>(accessor, realm, object_schema, object, true);
+    }
+    auto existing = realm::Object::get_for_primary_key(accessor, realm, object_schema, *primary_value);
+    if (!existing.is_valid()) {
+        return realm::Object::create<ValueType>(accessor, realm, object_schema, object, true);
+    }
+
+    for (size_t i = 0; i < object_schema.persisted_properties.size(); i++) {
+        auto &prop = object_schema.persisted_properties[i];
+        if (prop.is_primary) {
+            continue;
+        }
+
+        // As with other updates, properties that aren't given keep their current value.
+        auto value = accessor.value_for_property(object, prop.name, i);
+        if (!value) {
+            continue;
+        }
+
+        // Linked objects with a primary key are updated in the same way, and the link itself only
+        // written if it now points somewhere else.
+        if (is_link(prop.type) && !accessor.is_null(*value)) {
+            auto &target_schema = *realm->schema().find(prop.object_type);
+            ObjectType target = Value::validated_to_object(ctx, *value);
+            if (target_schema.primary_key_property() && !Object::template is_instance<RealmObjectClass<T>>(ctx, target)) {
+                if (Value::is_array(ctx, target)) {
+                    target = Schema<T>::dict_for_property_array(ctx, target_schema, target);
+                }
+                NativeAccessor target_accessor(accessor, prop);
+                value = static_cast<ValueType>(RealmObjectClass<T>::create_instance(ctx, create_modified(ctx, target_accessor, realm, target_schema, target)));
+            }
+        }
+        // So are the objects of a list, which is then compared by the objects it links to.
+        else if (is_link_list(prop.type) && Value::is_array(ctx, *value)) {
+            auto &target_schema = *realm->schema().find(prop.object_type);
+            if (target_schema.primary_key_property()) {
+                ObjectType array = Value::to_array(ctx, *value);
+                uint32_t length = Object::validated_get_length(ctx, array);
+                std::vector<ValueType> elements;
+                elements.reserve(length);
+                NativeAccessor target_accessor(accessor, prop);
+                for (uint32_t j = 0; j < length; j++) {
+                    ValueType element = Object::get_property(ctx, array, j);
+                    if (Value::is_object(ctx, element)) {
+                        ObjectType target = Value::to_object(ctx, element);
+                        if (!Object::template is_instance<RealmObjectClass<T>>(ctx, target)) {
+                            if (Value::is_array(ctx, target)) {
+                                target = Schema<T>::dict_for_property_array(ctx, target_schema, target);
+                            }
+                            element = static_cast<ValueType>(RealmObjectClass<T>::create_instance(ctx, create_modified(ctx, target_accessor, realm, target_schema, target)));
+                        }
+                    }
+                    elements.push_back(element);
+                }
+                value = static_cast<ValueType>(Object::create_array(ctx, elements));
+            }
+        }
+
+        if (!is_unchanged(ctx, accessor, existing, prop, *value)) {
+            existing.set_property_value(accessor, prop.name, *value, true);
+        }
+    }
+    return existing;
+}
+
+template<typename T>
+bool RealmClass<T>::is_unchanged(ContextType ctx, NativeAccessor &accessor, realm::Object &object, const Property &prop, ValueType value) {
+    using realm::PropertyType;
+
+    auto row = object.row();
+    size_t column = prop.table_column;
+
+    if (realm::is_array(prop.type)) {
+        // Only arrays are compared; Lists and Results are written as usual.
+        if (!Value::is_array(ctx, value)) {
+            return false;
+        }
+        realm::List list(object.realm(), *row.get_table(), column, row.get_index());
+        ObjectType array = Value::to_array(ctx, value);
+        if (Object::validated_get_length(ctx, array) != list.size()) {
+            return false;
+        }
+
+        bool nullable = is_nullable(prop.type);
+        switch (prop.type & ~PropertyType::Flags) {
+            case PropertyType::Int:
+                return nullable ? list_is_unchanged<util::Optional<int64_t>>(ctx, accessor, list, array) : list_is_unchanged<int64_t>(ctx, accessor, list, array);
+            case PropertyType::Bool:
+                return nullable ? list_is_unchanged<util::Optional<bool>>(ctx, accessor, list, array) : list_is_unchanged<bool>(ctx, accessor, list, array);
+            case PropertyType::Float:
+                return nullable ? list_is_unchanged<util::Optional<float>>(ctx, accessor, list, array) : list_is_unchanged<float>(ctx, accessor, list, array);
+            case PropertyType::Double:
+                return nullable ? list_is_unchanged<util::Optional<double>>(ctx, accessor, list, array) : list_is_unchanged<double>(ctx, accessor, list, array);
+            case PropertyType::String:
+                return list_is_unchanged<StringData>(ctx, accessor, list, array);
+            case PropertyType::Data:
+                return list_is_unchanged<BinaryData>(ctx, accessor, list, array);
+            case PropertyType::Date:
+                return list_is_unchanged<Timestamp>(ctx, accessor, list, array);
+            case PropertyType::Object:
+                for (size_t i = 0; i < list.size(); i++) {
+                    ValueType element = Object::get_property(ctx, array, (uint32_t)i);
+                    if (!Value::is_object(ctx, element)) {
+                        return false;
+                    }
+                    ObjectType element_object = Value::to_object(ctx, element);
+                    if (!Object::template is_instance<RealmObjectClass<T>>(ctx, element_object)) {
+                        return false;
+                    }
+                    auto element_realm_object = get_internal<T, RealmObjectClass<T>>(element_object);
+                    if (element_realm_object->realm() != object.realm() || !element_realm_object->is_valid()
+                        || element_realm_object->row().get_index() != list.get(i).get_index()) {
+                        return false;
+                    }
+                }
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    if (is_link(prop.type)) {
+        if (accessor.is_null(value)) {
+            return row.is_null_link(column);
+        }
+        ObjectType target = Value::validated_to_object(ctx, value);
+        if (row.is_null_link(column) || !Object::template is_instance<RealmObjectClass<T>>(ctx, target)) {
+            return false;
+        }
+        auto target_object = get_internal<T, RealmObjectClass<T>>(target);
+        return target_object->realm() == object.realm() && target_object->is_valid()
+            && target_object->row().get_index() == row.get_link(column);
+    }
+
+    if (accessor.is_null(value)) {
+        return is_nullable(prop.type) && row.is_null(column);
+    }
+    if (is_nullable(prop.type) && row.is_null(column)) {
+        return false;
+    }
+
+    switch (prop.type & ~PropertyType::Flags) {
+        case PropertyType::Int:
+            return row.get_int(column) == accessor.template unbox<int64_t>(value);
+        case PropertyType::Bool:
+            return row.get_bool(column) == accessor.template unbox<bool>(value);
+        case PropertyType::Float:
+            return is_same_value(row.get_float(column), accessor.template unbox<float>(value));
+        case PropertyType::Double:
+            return is_same_value(row.get_double(column), accessor.template unbox<double>(value));
+        case PropertyType::String:
+            return row.get_string(column) == accessor.template unbox<StringData>(value);
+        case PropertyType::Data:
+            return row.get_binary(column) == accessor.template unbox<BinaryData>(value);
+        case PropertyType::Date:
+            return row.get_timestamp(column) == accessor.template unbox<Timestamp>(value);
+        default:
+            return false;
+    }
+}
+
+template<typename T>
+template<typename U>
+bool RealmClass<T>::list_is_unchanged(ContextType ctx, NativeAccessor &accessor, realm::List &list, ObjectType array) {
+    for (size_t i = 0; i < list.size(); i++) {
+        if (!is_same_value(list.template get<U>(i), accessor.template unbox<U>(Object::get_property(ctx, array, (uint32_t)i)))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename T>
 void RealmClass<T>::delete_one(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     args.validate_maximum(1);
@@ -890,6 +1364,114 @@ void RealmClass<T>::delete_one(ContextType ctx, ObjectType this_object, Argument
     }
 }
 
+template<typename T>
+void RealmClass<T>::delete_where(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    realm->verify_open();
+
+    if (!realm->is_in_transaction()) {
+        throw std::runtime_error("Can only delete objects within a transaction.");
+    }
+
+    validate_argument_count_at_least(args.count, 2);
+    TableView rows = table_query(ctx, realm, args).find_all();
+    size_t count = rows.size();
+    rows.clear(RemoveMode::unordered);
+    return_value.set((double)count);
+}
+
+template<typename T>
+void RealmClass<T>::count(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    validate_argument_count_at_least(args.count, 1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    realm->verify_open();
+
+    return_value.set((double)table_query(ctx, realm, args).count());
+}
+
+template<typename T>
+void RealmClass<T>::exists(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    validate_argument_count_at_least(args.count, 1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    realm->verify_open();
+
+    // stop at the first match
+    return_value.set(table_query(ctx, realm, args).count(0, size_t(-1), 1) != 0);
+}
+
+template<typename T>
+void RealmClass<T>::define_view(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    validate_argument_count(args.count, 2, 4);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    realm->verify_open();
+    validate_notifications_supported<T>(ctx);
+    auto delegate = get_delegate<T>(realm.get());
+    std::string name = Value::validated_to_string(ctx, args[0], "name");
+
+    ValueType query_values[] = {args[1], args[2]};
+    bool has_predicate = !Value::is_undefined(ctx, args[2]) && !Value::is_null(ctx, args[2]);
+    Arguments query_args{ctx, has_predicate ? 2u : 1u, query_values};
+    realm::Results results(realm, table_query(ctx, realm, query_args));
+
+    if (args.count > 3 && !Value::is_undefined(ctx, args[3])) {
+        Arguments sort_args{ctx, 1, &args.value[3]};
+        results = results.sort(ResultsClass<T>::get_keypaths(ctx, sort_args));
+    }
+
+    ObjectType results_object = ResultsClass<T>::create_instance(ctx, std::move(results));
+    auto token = get_internal<T, ResultsClass<T>>(results_object)->add_notification_callback([](CollectionChangeSet, std::exception_ptr) {});
+    delegate->m_views.erase(name);
+    delegate->m_views.emplace(name, typename RealmDelegate<T>::View{Protected<ObjectType>(ctx, results_object), std::move(token)});
+
+    return_value.set(results_object);
+}
+
+template<typename T>
+void RealmClass<T>::view(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    realm->verify_open();
+    std::string name = Value::validated_to_string(ctx, args[0], "name");
+
+    auto delegate = get_delegate<T>(realm.get());
+    auto view = delegate->m_views.find(name);
+    if (view == delegate->m_views.end()) {
+        throw std::invalid_argument(util::format("No view named '%1' has been defined.", name));
+    }
+    ObjectType results = view->second.results;
+    return_value.set(results);
+}
+
+template<typename T>
+void RealmClass<T>::remove_view(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    realm->verify_open();
+    std::string name = Value::validated_to_string(ctx, args[0], "name");
+    get_delegate<T>(realm.get())->m_views.erase(name);
+}
+
+template<typename T>
+void RealmClass<T>::obtain_thread_safe_reference(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    return_value.set(ThreadSafeReferenceClass<T>::obtain(ctx, realm, Value::validated_to_object(ctx, args[0], "value")));
+}
+
+template<typename T>
+void RealmClass<T>::resolve_thread_safe_reference(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(1);
+
+    SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    return_value.set(ThreadSafeReferenceClass<T>::resolve(ctx, realm, args[0]));
+}
+
 template<typename T>
 void RealmClass<T>::delete_all(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     args.validate_maximum(0);
@@ -959,6 +1541,7 @@ void RealmClass<T>::add_listener(ContextType ctx, ObjectType this_object, Argume
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
     realm->verify_open();
+    validate_notifications_supported<T>(ctx);
     get_delegate<T>(realm.get())->add_notification(callback);
 }
 
@@ -991,6 +1574,12 @@ void RealmClass<T>::close(ContextType ctx, ObjectType this_object, Arguments arg
     args.validate_maximum(0);
 
     SharedRealm realm = *get_internal<T, RealmClass<T>>(this_object);
+    // The references obtained from the Realm keep it and their version alive until they're resolved.
+    ThreadSafeReferenceRegistry::shared().release_all(realm.get());
+    // The Results of the views hold the Realm, which would otherwise keep them and itself alive.
+    if (realm->m_binding_context) {
+        get_delegate<T>(realm.get())->m_views.clear();
+    }
     realm->close();
 }
 
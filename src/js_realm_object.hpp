@@ -22,6 +22,7 @@
 #include "object_store.hpp"
 
 #include "js_class.hpp"
+#include "js_object_serializer.hpp"
 #include "js_types.hpp"
 #include "js_util.hpp"
 #include "js_schema.hpp"
@@ -53,9 +54,13 @@ struct RealmObjectClass : ClassDefinition<T, realm::Object> {
     static void is_valid(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
     static void get_object_schema(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
     static void linking_objects(ContextType, FunctionType, ObjectType, size_t, const ValueType [], ReturnValue &);
+    static void linking_objects_count(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void to_json(ContextType, ObjectType, Arguments, ReturnValue &);
     static void get_object_id(ContextType, ObjectType, Arguments, ReturnValue &);
     static void is_same_object(ContextType, ObjectType, Arguments, ReturnValue &);
 
+    static std::pair<TableRef, size_t> get_backlink_source(ContextType, realm::Object &, const ValueType &, const ValueType &);
+
     const std::string name = "RealmObject";
 
     const StringPropertyType<T> string_accessor = {
@@ -68,6 +73,8 @@ struct RealmObjectClass : ClassDefinition<T, realm::Object> {
         {"isValid", wrap<is_valid>},
         {"objectSchema", wrap<get_object_schema>},
         {"linkingObjects", wrap<linking_objects>},
+        {"linkingObjectsCount", wrap<linking_objects_count>},
+        {"toJSON", wrap<to_json>},
         {"_objectId", wrap<get_object_id>},
         {"_isSameObject", wrap<is_same_object>},
     };
@@ -208,31 +215,103 @@ void RealmObjectClass<T>::is_same_object(ContextType ctx, ObjectType object, Arg
 #include "js_results.hpp"
 
 template<typename T>
-void realm::js::RealmObjectClass<T>::linking_objects(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
-    validate_argument_count(argc, 2);
-
-    std::string object_type = Value::validated_to_string(ctx, arguments[0], "objectType");
-    std::string property_name = Value::validated_to_string(ctx, arguments[1], "property");
+std::pair<realm::TableRef, size_t> realm::js::RealmObjectClass<T>::get_backlink_source(ContextType ctx, realm::Object &object, const ValueType &object_type_value, const ValueType &property_value) {
+    std::string object_type = Value::validated_to_string(ctx, object_type_value, "objectType");
+    std::string property_name = Value::validated_to_string(ctx, property_value, "property");
 
-    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
+    if (!object.is_valid()) {
+        throw std::runtime_error("Object is invalid. Either it has been previously deleted or the Realm it belongs to has been closed.");
+    }
 
-    auto target_object_schema = object->realm()->schema().find(object_type);
-    if (target_object_schema == object->realm()->schema().end()) {
-        throw std::logic_error(util::format("Could not find schema for type '%1'", object_type));
+    auto &realm = object.realm();
+    auto &schema = realm->schema();
+    auto delegate = get_delegate<T>(realm.get());
+    std::string key = object_type + '\0' + property_name;
+
+    const Property *link_property = nullptr;
+    TableRef table;
+    if (delegate) {
+        auto cached = delegate->m_backlink_sources.find(key);
+        if (cached != delegate->m_backlink_sources.end()) {
+            auto &source = cached->second;
+            if (source.object_schema_index < schema.size()) {
+                auto &target_object_schema = *(schema.begin() + source.object_schema_index);
+                auto &properties = target_object_schema.persisted_properties;
+                if (target_object_schema.name == object_type && source.property_index < properties.size() &&
+                    properties[source.property_index].name == property_name && source.table->is_attached()) {
+                    link_property = &properties[source.property_index];
+                    table = source.table;
+                }
+            }
+            if (!link_property) {
+                delegate->m_backlink_sources.erase(cached);
+            }
+        }
     }
 
-    auto link_property = target_object_schema->property_for_name(property_name);
     if (!link_property) {
-        throw std::logic_error(util::format("Type '%1' does not contain property '%2'", object_type, property_name));
+        auto target_object_schema = schema.find(object_type);
+        if (target_object_schema == schema.end()) {
+            throw std::logic_error(util::format("Could not find schema for type '%1'", object_type));
+        }
+
+        link_property = target_object_schema->property_for_name(property_name);
+        if (!link_property) {
+            throw std::logic_error(util::format("Type '%1' does not contain property '%2'", object_type, property_name));
+        }
+
+        table = ObjectStore::table_for_object_type(realm->read_group(), target_object_schema->name);
+
+        auto &properties = target_object_schema->persisted_properties;
+        if (delegate && link_property >= properties.data() && link_property < properties.data() + properties.size()) {
+            size_t object_schema_index = target_object_schema - schema.begin();
+            size_t property_index = link_property - properties.data();
+            delegate->m_backlink_sources.emplace(std::move(key), typename RealmDelegate<T>::BacklinkSource{object_schema_index, property_index, table});
+        }
     }
 
-    if (link_property->object_type != object->get_object_schema().name) {
-        throw std::logic_error(util::format("'%1.%2' is not a relationship to '%3'", object_type, property_name, object->get_object_schema().name));
+    if (link_property->object_type != object.get_object_schema().name) {
+        throw std::logic_error(util::format("'%1.%2' is not a relationship to '%3'", object_type, property_name, object.get_object_schema().name));
     }
 
-    realm::TableRef table = ObjectStore::table_for_object_type(object->realm()->read_group(), target_object_schema->name);
+    return {table, link_property->table_column};
+}
+
+template<typename T>
+void realm::js::RealmObjectClass<T>::linking_objects(ContextType ctx, FunctionType, ObjectType this_object, size_t argc, const ValueType arguments[], ReturnValue &return_value) {
+    validate_argument_count(argc, 2);
+
+    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
+    auto source = get_backlink_source(ctx, *object, arguments[0], arguments[1]);
+
     auto row = object->row();
-    auto tv = row.get_table()->get_backlink_view(row.get_index(), table.get(), link_property->table_column);
+    auto tv = row.get_table()->get_backlink_view(row.get_index(), source.first.get(), source.second);
 
     return_value.set(ResultsClass<T>::create_instance(ctx, realm::Results(object->realm(), std::move(tv))));
 }
+
+template<typename T>
+void realm::js::RealmObjectClass<T>::linking_objects_count(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(2);
+
+    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
+    auto source = get_backlink_source(ctx, *object, args[0], args[1]);
+
+    auto row = object->row();
+    return_value.set((double)row.get_table()->get_backlink_count(row.get_index(), *source.first, source.second));
+}
+
+template<typename T>
+void realm::js::RealmObjectClass<T>::to_json(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_maximum(1);
+
+    auto object = get_internal<T, RealmObjectClass<T>>(this_object);
+    if (!object->is_valid()) {
+        throw std::runtime_error("Object is invalid. Either it has been previously deleted or the Realm it belongs to has been closed.");
+    }
+
+    auto &object_schema = object->get_object_schema();
+    ObjectSerializer<T> serializer(ctx, object->realm(), object_schema, args[0]);
+    auto row = object->row();
+    return_value.set(serializer.serialize(object_schema, row.get_table()->get(row.get_index())));
+}
@@ -18,9 +18,12 @@
 
 #pragma once
 
+#include "js_aggregate.hpp"
 #include "js_collection.hpp"
 #include "js_realm_object.hpp"
 #include "js_util.hpp"
+#include "parallel_query.hpp"
+#include "primitive_query_builder.hpp"
 
 #include "results.hpp"
 #include "list.hpp"
@@ -53,6 +56,19 @@ class Results : public realm::Results {
     std::vector<std::pair<Protected<typename T::Function>, NotificationToken>> m_notification_tokens;
 };
 
+namespace _impl {
+
+// Whether a collection is all of the objects of a type.
+inline bool is_whole_table(const realm::Results &results) {
+    return results.get_mode() == realm::Results::Mode::Table;
+}
+
+inline bool is_whole_table(const realm::List &) {
+    return false;
+}
+
+} // namespace _impl
+
 template<typename T>
 struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<T>> {
     using Type = T;
@@ -60,6 +76,7 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
     using ObjectType = typename T::Object;
     using ValueType = typename T::Value;
     using FunctionType = typename T::Function;
+    using String = js::String<T>;
     using Object = js::Object<T>;
     using Value = js::Value<T>;
     using ReturnValue = js::ReturnValue<T>;
@@ -70,8 +87,11 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
 
     template<typename U>
     static ObjectType create_filtered(ContextType, const U &, Arguments);
+    static size_t get_parallel_option(ContextType, Arguments &);
 
     static std::vector<std::pair<std::string, bool>> get_keypaths(ContextType, Arguments);
+    static std::vector<std::string> get_distinct_keypaths(ContextType, Arguments);
+    static realm::Results make_distinct(const realm::Results &, const std::vector<std::string> &);
 
     static void get_length(ContextType, ObjectType, ReturnValue &);
     static void get_type(ContextType, ObjectType, ReturnValue &);
@@ -81,7 +101,10 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
     static void snapshot(ContextType, ObjectType, Arguments, ReturnValue &);
     static void filtered(ContextType, ObjectType, Arguments, ReturnValue &);
     static void sorted(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void distinct(ContextType, ObjectType, Arguments, ReturnValue &);
     static void is_valid(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void search(ContextType, ObjectType, Arguments, ReturnValue &);
+    static void live_aggregate(ContextType, ObjectType, Arguments, ReturnValue &);
 
     static void index_of(ContextType, ObjectType, Arguments, ReturnValue &);
 
@@ -106,11 +129,17 @@ struct ResultsClass : ClassDefinition<T, realm::js::Results<T>, CollectionClass<
         {"snapshot", wrap<snapshot>},
         {"filtered", wrap<filtered>},
         {"sorted", wrap<sorted>},
+        {"distinct", wrap<distinct>},
         {"isValid", wrap<is_valid>},
+        {"search", wrap<search>},
         {"min", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Min>>},
         {"max", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Max>>},
         {"sum", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Sum>>},
         {"avg", wrap<compute_aggregate_on_collection<ResultsClass<T>, AggregateFunc::Avg>>},
+        {"aggregate", wrap<compute_aggregates_on_collection<ResultsClass<T>>>},
+        {"_groupedAggregate", wrap<compute_grouped_aggregates_on_collection<ResultsClass<T>>>},
+        {"liveAggregate", wrap<live_aggregate>},
+        {"toJSON", wrap<serialize_collection<ResultsClass<T>>>},
         {"addListener", wrap<add_listener>},
         {"removeListener", wrap<remove_listener>},
         {"removeAllListeners", wrap<remove_all_listeners>},
@@ -144,23 +173,70 @@ typename T::Object ResultsClass<T>::create_instance(ContextType ctx, SharedRealm
 template<typename T>
 template<typename U>
 typename T::Object ResultsClass<T>::create_filtered(ContextType ctx, const U &collection, Arguments args) {
-    if (collection.get_type() != realm::PropertyType::Object) {
-        throw std::runtime_error("Filtering non-object Lists and Results is not yet implemented.");
+    size_t parallel = get_parallel_option(ctx, args);
+    if (parallel && !_impl::is_whole_table(collection)) {
+        throw std::invalid_argument("The 'parallel' option can only be used to filter all of the objects of a type.");
     }
-
     auto query_string = Value::validated_to_string(ctx, args[0], "predicate");
     auto query = collection.get_query();
     auto const &realm = collection.get_realm();
-    auto const &object_schema = collection.get_object_schema();
-
     parser::Predicate predicate = parser::parse(query_string);
+
+    if (collection.get_type() != realm::PropertyType::Object) {
+        // Lists of primitive values are queried on 'self'.
+        NativeAccessor<T> accessor(ctx, collection);
+        query_builder::ArgumentConverter<ValueType, NativeAccessor<T>> converter(accessor, &args.value[1], args.count - 1);
+        primitive_query_builder::apply_predicate(query, predicate, converter, collection.get_type());
+        return create_instance(ctx, collection.filter(std::move(query)));
+    }
+
+    auto const &object_schema = collection.get_object_schema();
     NativeAccessor<T> accessor(ctx, realm, object_schema);
     query_builder::ArgumentConverter<ValueType, NativeAccessor<T>> converter(accessor, &args.value[1], args.count - 1);
     query_builder::apply_predicate(query, predicate, converter);
 
+    if (parallel) {
+        // Other Realm instances can't see the changes of a write transaction.
+        if (!realm->is_in_transaction()) {
+            return create_instance(ctx, parallel_query::find_all(collection.filter(std::move(query)), parallel));
+        }
+        return create_instance(ctx, collection.filter(std::move(query)).snapshot());
+    }
     return create_instance(ctx, collection.filter(std::move(query)));
 }
 
+// Returns the `parallel` option of filtered(), given as an object after the query arguments, as in
+// `filtered('age > $0', 18, {parallel: 8})`, and removes it from `args`. Returns 0 if it isn't given.
+// Query arguments which are objects are Realm objects, Dates or binary data, so a plain object with a
+// `parallel` property is unambiguous.
+template<typename T>
+size_t ResultsClass<T>::get_parallel_option(ContextType ctx, Arguments &args) {
+    static const String parallel_string = "parallel";
+
+    if (args.count < 2 || !Value::is_object(ctx, args[args.count - 1])) {
+        return 0;
+    }
+    ValueType last = args[args.count - 1];
+    if (Value::is_array(ctx, last) || Value::is_date(ctx, last) || Value::is_binary(ctx, last)) {
+        return 0;
+    }
+    ObjectType options = Value::to_object(ctx, last);
+    if (Object::template is_instance<RealmObjectClass<T>>(ctx, options)) {
+        return 0;
+    }
+    ValueType parallel_value = Object::get_property(ctx, options, parallel_string);
+    if (Value::is_undefined(ctx, parallel_value)) {
+        return 0;
+    }
+
+    double parallel = Value::validated_to_number(ctx, parallel_value, "parallel");
+    if (!(parallel >= 1) || parallel != double(size_t(parallel))) {
+        throw std::invalid_argument("parallel must be a positive integer.");
+    }
+    args.count--;
+    return size_t(parallel);
+}
+
 template<typename T>
 std::vector<std::pair<std::string, bool>>
 ResultsClass<T>::get_keypaths(ContextType ctx, Arguments args) {
@@ -203,6 +279,46 @@ ResultsClass<T>::get_keypaths(ContextType ctx, Arguments args) {
     return sort_order;
 }
 
+template<typename T>
+std::vector<std::string> ResultsClass<T>::get_distinct_keypaths(ContextType ctx, Arguments args) {
+    args.validate_maximum(1);
+
+    std::vector<std::string> keypaths;
+    if (args.count == 0) {
+        keypaths.emplace_back("self");
+    }
+    else if (Value::is_array(ctx, args[0])) {
+        ObjectType js_prop_names = Value::to_array(ctx, args[0]);
+        size_t prop_count = Object::validated_get_length(ctx, js_prop_names);
+        keypaths.reserve(prop_count);
+
+        for (unsigned int i = 0; i < prop_count; i++) {
+            keypaths.push_back(Object::validated_get_string(ctx, js_prop_names, i));
+        }
+    }
+    else {
+        keypaths.push_back(Value::validated_to_string(ctx, args[0]));
+    }
+    return keypaths;
+}
+
+template<typename T>
+realm::Results ResultsClass<T>::make_distinct(const realm::Results &results, const std::vector<std::string> &keypaths) {
+    auto type = results.get_type();
+    if (type == realm::PropertyType::Object) {
+        return results.distinct(keypaths);
+    }
+
+    // Primitive values are stored in the only column of their table.
+    for (auto &keypath : keypaths) {
+        if (keypath != "self") {
+            throw std::invalid_argument(util::format("Cannot distinct on key path '%1': arrays of '%2' can only be distinct on 'self'",
+                                                     keypath, string_for_property_type(type & ~realm::PropertyType::Flags)));
+        }
+    }
+    return results.distinct(DistinctDescriptor(*results.get_query().get_table(), {{0}}));
+}
+
 template<typename T>
 void ResultsClass<T>::get_length(ContextType ctx, ObjectType object, ReturnValue &return_value) {
     auto results = get_internal<T, ResultsClass<T>>(object);
@@ -247,11 +363,75 @@ void ResultsClass<T>::sorted(ContextType ctx, ObjectType this_object, Arguments
     return_value.set(ResultsClass<T>::create_instance(ctx, results->sort(ResultsClass<T>::get_keypaths(ctx, args))));
 }
 
+template<typename T>
+void ResultsClass<T>::distinct(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    return_value.set(ResultsClass<T>::create_instance(ctx, make_distinct(*results, get_distinct_keypaths(ctx, args))));
+}
+
 template<typename T>
 void ResultsClass<T>::is_valid(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     return_value.set(get_internal<T, ResultsClass<T>>(this_object)->is_valid());
 }
 
+template<typename T>
+void ResultsClass<T>::search(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(2);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    if (results->get_type() != realm::PropertyType::Object) {
+        throw std::invalid_argument("Only collections of Realm objects can be searched.");
+    }
+    auto &object_schema = results->get_object_schema();
+    std::string property_name = Value::validated_to_string(ctx, args[0], "property");
+
+    std::vector<std::string> terms;
+    if (Value::is_array(ctx, args[1])) {
+        ObjectType terms_array = Value::to_array(ctx, args[1]);
+        uint32_t count = Object::validated_get_length(ctx, terms_array);
+        for (uint32_t i = 0; i < count; i++) {
+            terms.push_back(Object::validated_get_string(ctx, terms_array, i, "terms"));
+        }
+    }
+    else {
+        terms.push_back(Value::validated_to_string(ctx, args[1], "terms"));
+    }
+
+    const Property *property = object_schema.property_for_name(property_name);
+    if (!property) {
+        throw std::invalid_argument(util::format("Property '%1' does not exist on object '%2'", property_name, object_schema.name));
+    }
+    if (property->type != realm::PropertyType::String && property->type != (realm::PropertyType::String | realm::PropertyType::Nullable)) {
+        throw std::invalid_argument(util::format("Property '%1.%2' of type '%3' cannot be searched.",
+                                                 object_schema.name, property_name, string_for_property_type(property->type)));
+    }
+
+    auto realm = results->get_realm();
+    auto delegate = get_delegate<T>(realm.get());
+    std::vector<size_t> rows = delegate->full_text_index(*realm, object_schema, *property).search(terms);
+    TableRef table = ObjectStore::table_for_object_type(realm->read_group(), object_schema.name);
+
+    // Objects which aren't in this collection are left out. The table itself needs no checking, and
+    // there is nothing to check when nothing matched. Otherwise the rows of the collection are taken
+    // from its table view, which the Results keeps evaluated, rather than by getting its objects.
+    if (results->get_mode() != realm::Results::Mode::Table && !rows.empty()) {
+        realm::TableView members = results->get_tableview();
+        std::vector<bool> is_member(table->size());
+        for (size_t i = 0, size = members.size(); i < size; i++) {
+            is_member[members.get_source_ndx(i)] = true;
+        }
+        rows.erase(std::remove_if(rows.begin(), rows.end(), [&](size_t row) { return !is_member[row]; }), rows.end());
+    }
+
+    NativeAccessor<T> accessor(ctx, *results);
+    std::vector<ValueType> objects;
+    objects.reserve(rows.size());
+    for (size_t row : rows) {
+        objects.push_back(accessor.box(table->get(row)));
+    }
+    return_value.set(Object::create_array(ctx, objects));
+}
+
 template<typename T>
 template<typename Fn>
 void ResultsClass<T>::index_of(ContextType ctx, Fn& fn, Arguments args, ReturnValue &return_value) {
@@ -319,6 +499,7 @@ void ResultsClass<T>::add_listener(ContextType ctx, U& collection, ObjectType th
     args.validate_maximum(1);
 
     auto callback = Value::validated_to_function(ctx, args[0]);
+    validate_notifications_supported<T>(ctx);
     Protected<FunctionType> protected_callback(ctx, callback);
     Protected<ObjectType> protected_this(ctx, this_object);
     Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
@@ -361,6 +542,46 @@ void ResultsClass<T>::remove_listener(ContextType ctx, ObjectType this_object, A
     remove_listener(ctx, *results, this_object, args);
 }
 
+template<typename T>
+void ResultsClass<T>::live_aggregate(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_count(2);
+
+    auto results = get_internal<T, ResultsClass<T>>(this_object);
+    if (results->get_type() != realm::PropertyType::Object) {
+        throw std::runtime_error("Aggregating non-object Lists and Results is not yet implemented.");
+    }
+
+    auto description = Value::validated_to_object(ctx, args[0], "aggregates");
+    auto aggregation = std::make_shared<IncrementalAggregation<T>>(ctx, results->get_object_schema(), description);
+    auto callback = Value::validated_to_function(ctx, args[1]);
+    validate_notifications_supported<T>(ctx);
+
+    aggregation->reset(*results);
+    ObjectType aggregates = Object::create_empty(ctx);
+    aggregation->set_results(ctx, *results, aggregates);
+
+    Protected<FunctionType> protected_callback(ctx, callback);
+    Protected<ObjectType> protected_this(ctx, this_object);
+    Protected<ObjectType> protected_aggregates(ctx, aggregates);
+    Protected<typename T::GlobalContext> protected_ctx(Context<T>::get_global_context(ctx));
+
+    auto token = results->add_notification_callback([=](CollectionChangeSet const& change_set, std::exception_ptr exception) {
+        HANDLESCOPE
+        auto results = get_internal<T, ResultsClass<T>>(static_cast<ObjectType>(protected_this));
+        aggregation->apply(*results, change_set);
+        aggregation->set_results(protected_ctx, *results, static_cast<ObjectType>(protected_aggregates));
+
+        ValueType arguments[] {
+            static_cast<ObjectType>(protected_aggregates),
+            CollectionClass<T>::create_collection_change_set(protected_ctx, change_set)
+        };
+        Function<T>::callback(protected_ctx, protected_callback, protected_this, 2, arguments);
+    });
+    results->m_notification_tokens.emplace_back(protected_callback, std::move(token));
+
+    return_value.set(aggregates);
+}
+
 template<typename T>
 void ResultsClass<T>::remove_all_listeners(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
     args.validate_maximum(0);
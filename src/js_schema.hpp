@@ -19,6 +19,7 @@
 #pragma once
 
 #include <map>
+#include <set>
 
 #include "js_types.hpp"
 #include "schema.hpp"
@@ -39,11 +40,13 @@ struct Schema {
     using ObjectDefaults = std::map<std::string, Protected<ValueType>>;
     using ObjectDefaultsMap = std::map<std::string, ObjectDefaults>;
     using ConstructorMap = std::map<std::string, Protected<FunctionType>>;
+    // The names of the properties declared with `fullTextIndexed: true`, by object type.
+    using FullTextIndexedMap = std::map<std::string, std::set<std::string>>;
 
     static ObjectType dict_for_property_array(ContextType, const ObjectSchema &, ObjectType);
-    static Property parse_property(ContextType, ValueType, StringData, std::string, ObjectDefaults &);
-    static ObjectSchema parse_object_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
-    static realm::Schema parse_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &);
+    static Property parse_property(ContextType, ValueType, StringData, std::string, ObjectDefaults &, std::set<std::string> &);
+    static ObjectSchema parse_object_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &, FullTextIndexedMap &);
+    static realm::Schema parse_schema(ContextType, ObjectType, ObjectDefaultsMap &, ConstructorMap &, FullTextIndexedMap &);
 
     static ObjectType object_for_schema(ContextType, const realm::Schema &);
     static ObjectType object_for_object_schema(ContextType, const ObjectSchema &);
@@ -134,9 +137,11 @@ static inline void parse_property_type(StringData object_name, Property& prop, S
 
 template<typename T>
 Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, StringData object_name,
-                                   std::string property_name, ObjectDefaults &object_defaults) {
+                                   std::string property_name, ObjectDefaults &object_defaults,
+                                   std::set<std::string> &full_text_indexed) {
     static const String default_string = "default";
     static const String indexed_string = "indexed";
+    static const String full_text_indexed_string = "fullTextIndexed";
     static const String type_string = "type";
     static const String object_type_string = "objectType";
     static const String optional_string = "optional";
@@ -169,6 +174,15 @@ Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, String
         if (!Value::is_undefined(ctx, indexed_value)) {
             prop.is_indexed = Value::validated_to_boolean(ctx, indexed_value);
         }
+
+        ValueType full_text_indexed_value = Object::get_property(ctx, property_object, full_text_indexed_string);
+        if (!Value::is_undefined(ctx, full_text_indexed_value) && Value::validated_to_boolean(ctx, full_text_indexed_value, "fullTextIndexed")) {
+            if (prop.type != PropertyType::String && prop.type != (PropertyType::String | PropertyType::Nullable)) {
+                throw std::logic_error(util::format("Property '%1.%2' of type '%3' cannot be full-text indexed.",
+                                                    object_name, prop.name, property_type));
+            }
+            full_text_indexed.insert(prop.name);
+        }
     }
     else {
         std::string property_type = Value::validated_to_string(ctx, attributes);
@@ -196,7 +210,8 @@ Property Schema<T>::parse_property(ContextType ctx, ValueType attributes, String
 }
 
 template<typename T>
-ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_schema_object, ObjectDefaultsMap &defaults, ConstructorMap &constructors) {
+ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_schema_object, ObjectDefaultsMap &defaults,
+                                             ConstructorMap &constructors, FullTextIndexedMap &full_text_indexed) {
     static const String name_string = "name";
     static const String primary_string = "primaryKey";
     static const String properties_string = "properties";
@@ -209,6 +224,7 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
     }
 
     ObjectDefaults object_defaults;
+    std::set<std::string> object_full_text_indexed;
     ObjectSchema object_schema;
     object_schema.name = Object::validated_get_string(ctx, object_schema_object, name_string, "ObjectSchema");
 
@@ -218,7 +234,8 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
         for (uint32_t i = 0; i < length; i++) {
             ObjectType property_object = Object::validated_get_object(ctx, properties_object, i);
             std::string property_name = Object::validated_get_string(ctx, property_object, name_string);
-            Property property = parse_property(ctx, property_object, object_schema.name, std::move(property_name), object_defaults);
+            Property property = parse_property(ctx, property_object, object_schema.name, std::move(property_name),
+                                               object_defaults, object_full_text_indexed);
             if (property.type == realm::PropertyType::LinkingObjects) {
                 object_schema.computed_properties.emplace_back(std::move(property));
             }
@@ -232,7 +249,8 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
         auto property_names = Object::get_property_names(ctx, properties_object);
         for (auto& property_name : property_names) {
             ValueType property_value = Object::get_property(ctx, properties_object, property_name);
-            Property property = parse_property(ctx, property_value, object_schema.name, property_name, object_defaults);
+            Property property = parse_property(ctx, property_value, object_schema.name, property_name,
+                                               object_defaults, object_full_text_indexed);
             if (property.type == realm::PropertyType::LinkingObjects) {
                 object_schema.computed_properties.emplace_back(std::move(property));
             }
@@ -258,19 +276,23 @@ ObjectSchema Schema<T>::parse_object_schema(ContextType ctx, ObjectType object_s
     }
 
     defaults.emplace(object_schema.name, std::move(object_defaults));
+    if (!object_full_text_indexed.empty()) {
+        full_text_indexed.emplace(object_schema.name, std::move(object_full_text_indexed));
+    }
 
     return object_schema;
 }
 
 template<typename T>
 realm::Schema Schema<T>::parse_schema(ContextType ctx, ObjectType schema_object,
-                                      ObjectDefaultsMap &defaults, ConstructorMap &constructors) {
+                                      ObjectDefaultsMap &defaults, ConstructorMap &constructors,
+                                      FullTextIndexedMap &full_text_indexed) {
     std::vector<ObjectSchema> schema;
     uint32_t length = Object::validated_get_length(ctx, schema_object);
 
     for (uint32_t i = 0; i < length; i++) {
         ObjectType object_schema_object = Object::validated_get_object(ctx, schema_object, i, "ObjectSchema");
-        ObjectSchema object_schema = parse_object_schema(ctx, object_schema_object, defaults, constructors);
+        ObjectSchema object_schema = parse_object_schema(ctx, object_schema_object, defaults, constructors, full_text_indexed);
         schema.emplace_back(std::move(object_schema));
     }
 
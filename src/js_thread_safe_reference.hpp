@@ -0,0 +1,289 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "js_class.hpp"
+#include "js_list.hpp"
+#include "js_realm_object.hpp"
+#include "js_results.hpp"
+#include "js_types.hpp"
+#include "js_util.hpp"
+
+#include "shared_realm.hpp"
+#include "thread_safe_reference.hpp"
+
+namespace realm {
+namespace js {
+
+// The thread safe references of the process, by id. JavaScript values can't be shared between the
+// isolates of worker threads, but numbers can be posted from one to another, so a reference obtained
+// on one thread is kept here until it is resolved by the id of its Realm.ThreadSafeReference.
+class ThreadSafeReferenceRegistry {
+  public:
+    enum class Kind { Object, List, Results };
+
+    struct Entry {
+        Kind kind;
+        std::string path;
+        // The Realm the reference was obtained from, which the reference keeps alive.
+        const realm::Realm *source = nullptr;
+        std::unique_ptr<ThreadSafeReference<realm::Object>> object;
+        std::unique_ptr<ThreadSafeReference<realm::List>> list;
+        std::unique_ptr<ThreadSafeReference<realm::Results>> results;
+    };
+
+    static ThreadSafeReferenceRegistry &shared() {
+        static ThreadSafeReferenceRegistry registry;
+        return registry;
+    }
+
+    uint64_t add(Entry entry) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        uint64_t id = m_next_id++;
+        m_entries.emplace(id, std::move(entry));
+        return id;
+    }
+
+    // Removes the reference with `id` so that it can be resolved by the Realm at `path`.
+    Entry take(uint64_t id, const std::string &path) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it == m_entries.end()) {
+            throw std::runtime_error(util::format("Thread safe reference %1 does not exist or has already been resolved.", id));
+        }
+        if (it->second.path != path) {
+            throw std::runtime_error(util::format("Thread safe reference %1 was obtained from the Realm at '%2' and cannot be resolved by the Realm at '%3'.",
+                                                  id, it->second.path, path));
+        }
+        Entry entry = std::move(it->second);
+        m_entries.erase(it);
+        return entry;
+    }
+
+    // Drops the reference with `id` if it hasn't been resolved yet.
+    void release(uint64_t id) {
+        Entry entry;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(id);
+        if (it != m_entries.end()) {
+            // Destroyed once the lock is released, as destroying a reference unpins its version.
+            entry = std::move(it->second);
+            m_entries.erase(it);
+        }
+    }
+
+    // Drops the references obtained from `source`, which is being closed.
+    void release_all(const realm::Realm *source) {
+        std::vector<Entry> entries;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->second.source == source) {
+                entries.push_back(std::move(it->second));
+                it = m_entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    bool contains(uint64_t id) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.count(id) != 0;
+    }
+
+  private:
+    std::mutex m_mutex;
+    std::map<uint64_t, Entry> m_entries;
+    uint64_t m_next_id = 1;
+};
+
+// What a Realm.ThreadSafeReference knows about the reference it stands for, which itself is kept by
+// the registry.
+struct ThreadSafeReferenceHandle {
+    uint64_t id;
+    ThreadSafeReferenceRegistry::Kind kind;
+    std::string object_type;
+};
+
+template<typename T>
+struct ThreadSafeReferenceClass : ClassDefinition<T, ThreadSafeReferenceHandle> {
+    using ContextType = typename T::Context;
+    using ObjectType = typename T::Object;
+    using ValueType = typename T::Value;
+    using Object = js::Object<T>;
+    using Value = js::Value<T>;
+    using Arguments = js::Arguments<T>;
+    using ReturnValue = js::ReturnValue<T>;
+    using Kind = ThreadSafeReferenceRegistry::Kind;
+
+    // Obtains a reference to `value`, a Realm object, List or Results of `realm`.
+    static ObjectType obtain(ContextType, const SharedRealm &realm, ObjectType value);
+    // Resolves the reference `value`, a Realm.ThreadSafeReference or its id, in `realm`.
+    static ValueType resolve(ContextType, const SharedRealm &realm, ValueType value);
+
+    static void get_id(ContextType, ObjectType, ReturnValue &);
+    static void get_type(ContextType, ObjectType, ReturnValue &);
+    static void get_object_type(ContextType, ObjectType, ReturnValue &);
+    static void get_is_resolved(ContextType, ObjectType, ReturnValue &);
+
+    static void release(ContextType, ObjectType, Arguments, ReturnValue &);
+
+    std::string const name = "ThreadSafeReference";
+
+    MethodMap<T> const methods = {
+        {"release", wrap<release>},
+    };
+
+    PropertyMap<T> const properties = {
+        {"id", {wrap<get_id>, nullptr}},
+        {"type", {wrap<get_type>, nullptr}},
+        {"objectType", {wrap<get_object_type>, nullptr}},
+        {"isResolved", {wrap<get_is_resolved>, nullptr}},
+    };
+
+  private:
+    static void verify_realm(const SharedRealm &realm, const SharedRealm &value_realm) {
+        if (realm != value_realm) {
+            throw std::runtime_error("Cannot obtain a thread safe reference to an object or collection of another Realm.");
+        }
+    }
+};
+
+template<typename T>
+typename T::Object ThreadSafeReferenceClass<T>::obtain(ContextType ctx, const SharedRealm &realm, ObjectType value) {
+    realm->verify_open();
+
+    ThreadSafeReferenceRegistry::Entry entry;
+    entry.path = realm->config().path;
+    entry.source = realm.get();
+    std::string object_type;
+    if (Object::template is_instance<RealmObjectClass<T>>(ctx, value)) {
+        auto object = get_internal<T, RealmObjectClass<T>>(value);
+        verify_realm(realm, object->realm());
+        if (!object->is_valid()) {
+            throw std::runtime_error("Object is invalid. Either it has been previously deleted or the Realm it belongs to has been closed.");
+        }
+        entry.kind = Kind::Object;
+        entry.object.reset(new ThreadSafeReference<realm::Object>(realm->obtain_thread_safe_reference(*object)));
+        object_type = object->get_object_schema().name;
+    }
+    else if (Object::template is_instance<ListClass<T>>(ctx, value)) {
+        auto list = get_internal<T, ListClass<T>>(value);
+        verify_realm(realm, list->get_realm());
+        entry.kind = Kind::List;
+        entry.list.reset(new ThreadSafeReference<realm::List>(realm->obtain_thread_safe_reference(static_cast<const realm::List &>(*list))));
+        object_type = list->get_type() == realm::PropertyType::Object ? list->get_object_schema().name : string_for_property_type(list->get_type() & ~realm::PropertyType::Flags);
+    }
+    else if (Object::template is_instance<ResultsClass<T>>(ctx, value)) {
+        auto results = get_internal<T, ResultsClass<T>>(value);
+        verify_realm(realm, results->get_realm());
+        entry.kind = Kind::Results;
+        entry.results.reset(new ThreadSafeReference<realm::Results>(realm->obtain_thread_safe_reference(static_cast<const realm::Results &>(*results))));
+        object_type = results->get_type() == realm::PropertyType::Object ? results->get_object_schema().name : string_for_property_type(results->get_type() & ~realm::PropertyType::Flags);
+    }
+    else {
+        throw std::invalid_argument("Thread safe references can only be obtained for Realm objects, Lists and Results.");
+    }
+
+    Kind kind = entry.kind;
+    uint64_t id = ThreadSafeReferenceRegistry::shared().add(std::move(entry));
+    return create_object<T, ThreadSafeReferenceClass<T>>(ctx, new ThreadSafeReferenceHandle{id, kind, std::move(object_type)});
+}
+
+template<typename T>
+typename T::Value ThreadSafeReferenceClass<T>::resolve(ContextType ctx, const SharedRealm &realm, ValueType value) {
+    realm->verify_open();
+
+    uint64_t id;
+    if (Value::is_object(ctx, value) && Object::template is_instance<ThreadSafeReferenceClass<T>>(ctx, Value::to_object(ctx, value))) {
+        id = get_internal<T, ThreadSafeReferenceClass<T>>(Value::to_object(ctx, value))->id;
+    }
+    else {
+        double number = Value::validated_to_number(ctx, value, "reference");
+        if (!(number >= 1) || number != uint64_t(number)) {
+            throw std::invalid_argument("reference must be a Realm.ThreadSafeReference or its id.");
+        }
+        id = uint64_t(number);
+    }
+    if (realm->is_in_transaction()) {
+        throw std::runtime_error("Cannot resolve a thread safe reference during a write transaction.");
+    }
+
+    auto entry = ThreadSafeReferenceRegistry::shared().take(id, realm->config().path);
+    switch (entry.kind) {
+        case Kind::Object: {
+            auto object = realm->resolve_thread_safe_reference(std::move(*entry.object));
+            if (!object.is_valid()) {
+                return Value::from_null(ctx);
+            }
+            return RealmObjectClass<T>::create_instance(ctx, std::move(object));
+        }
+        case Kind::List: {
+            auto list = realm->resolve_thread_safe_reference(std::move(*entry.list));
+            if (!list.is_valid()) {
+                return Value::from_null(ctx);
+            }
+            return ListClass<T>::create_instance(ctx, std::move(list));
+        }
+        case Kind::Results:
+            return ResultsClass<T>::create_instance(ctx, realm->resolve_thread_safe_reference(std::move(*entry.results)));
+    }
+    REALM_UNREACHABLE();
+}
+
+template<typename T>
+void ThreadSafeReferenceClass<T>::get_id(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(double(get_internal<T, ThreadSafeReferenceClass<T>>(object)->id));
+}
+
+template<typename T>
+void ThreadSafeReferenceClass<T>::get_type(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    switch (get_internal<T, ThreadSafeReferenceClass<T>>(object)->kind) {
+        case Kind::Object: return_value.set("object"); break;
+        case Kind::List: return_value.set("list"); break;
+        case Kind::Results: return_value.set("results"); break;
+    }
+}
+
+template<typename T>
+void ThreadSafeReferenceClass<T>::get_object_type(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(get_internal<T, ThreadSafeReferenceClass<T>>(object)->object_type);
+}
+
+template<typename T>
+void ThreadSafeReferenceClass<T>::get_is_resolved(ContextType ctx, ObjectType object, ReturnValue &return_value) {
+    return_value.set(!ThreadSafeReferenceRegistry::shared().contains(get_internal<T, ThreadSafeReferenceClass<T>>(object)->id));
+}
+
+template<typename T>
+void ThreadSafeReferenceClass<T>::release(ContextType ctx, ObjectType this_object, Arguments args, ReturnValue &return_value) {
+    args.validate_maximum(0);
+    ThreadSafeReferenceRegistry::shared().release(get_internal<T, ThreadSafeReferenceClass<T>>(this_object)->id);
+}
+
+} // js
+} // realm
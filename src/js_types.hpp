@@ -79,6 +79,7 @@ struct Context {
 
     static GlobalContextType get_global_context(ContextType);
     static AbstractExecutionContextID get_execution_context_id(ContextType);
+    static bool supports_notifications(ContextType);
 };
 
 class TypeErrorException : public std::invalid_argument {
@@ -112,6 +113,7 @@ struct Value {
     static bool is_array(ContextType, const ValueType &);
     static bool is_array_buffer(ContextType, const ValueType &);
     static bool is_array_buffer_view(ContextType, const ValueType &);
+    static bool is_bigint(ContextType, const ValueType &);
     static bool is_boolean(ContextType, const ValueType &);
     static bool is_constructor(ContextType, const ValueType &);
     static bool is_date(ContextType, const ValueType &);
@@ -130,11 +132,15 @@ struct Value {
     static ValueType from_boolean(ContextType, bool);
     static ValueType from_null(ContextType);
     static ValueType from_number(ContextType, double);
+    static ValueType from_int64(ContextType, int64_t);
+    static ValueType from_bigint(ContextType, int64_t);
     static ValueType from_string(ContextType ctx, const char *s) { return s ? from_nonnull_string(ctx, s) : from_null(ctx); }
-    static ValueType from_string(ContextType ctx, StringData s) { return s ? from_nonnull_string(ctx, s) : from_null(ctx); }
+    static ValueType from_string(ContextType ctx, StringData s) { return s ? from_nonnull_string_data(ctx, s) : from_null(ctx); }
     static ValueType from_string(ContextType ctx, const std::string& s) { return from_nonnull_string(ctx, s.c_str()); }
     static ValueType from_binary(ContextType ctx, BinaryData b) { return b ? from_nonnull_binary(ctx, b) : from_null(ctx); }
     static ValueType from_nonnull_string(ContextType, const String<T>&);
+    // Length-aware conversion of string data that need not be null-terminated (e.g. read directly from a Realm).
+    static ValueType from_nonnull_string_data(ContextType, StringData);
     static ValueType from_nonnull_binary(ContextType, BinaryData);
     static ValueType from_undefined(ContextType);
     static ValueType from_timestamp(ContextType, Timestamp);
@@ -146,9 +152,21 @@ struct Value {
     static ObjectType to_date(ContextType, const ValueType &);
     static FunctionType to_function(ContextType, const ValueType &);
     static double to_number(ContextType, const ValueType &);
+    // Integral value of a number, throwing if it doesn't fit in 64 bits.
+    static int64_t to_int64(ContextType, const ValueType &);
+    // Value of a BigInt, throwing if it doesn't fit in 64 bits.
+    static int64_t to_bigint(ContextType, const ValueType &);
     static ObjectType to_object(ContextType, const ValueType &);
     static String<T> to_string(ContextType, const ValueType &);
+    // Writes the UTF-8 contents of a string value into `buffer`, reusing its existing capacity.
+    static void to_string(ContextType, const ValueType &, std::string &buffer);
     static OwnedBinaryData to_binary(ContextType, ValueType);
+    // The name of the type of a TypedArray, such as "Float64Array", or nullptr for any other value.
+    // Subclasses of the TypedArray types and arrays created by other global objects are recognized.
+    static const char *typed_array_type(ContextType, const ValueType &);
+    // The bytes of a TypedArray's view of its buffer. They are read in place where the engine allows
+    // it and copied into `storage` otherwise, and either way must not be used once JavaScript has run.
+    static BinaryData typed_array_bytes(ContextType, const ValueType &, OwnedBinaryData &storage);
 
 
 #define VALIDATED(return_t, type) \
@@ -380,6 +398,7 @@ inline bool Value<T>::is_valid_for_property_type(ContextType context, const Valu
         }
         switch (type & ~PropertyType::Flags) {
             case PropertyType::Int:
+                return is_number(context, value) || is_bigint(context, value);
             case PropertyType::Float:
             case PropertyType::Double:
                 return is_number(context, value);
@@ -390,7 +409,7 @@ inline bool Value<T>::is_valid_for_property_type(ContextType context, const Valu
             case PropertyType::Data:
                 return is_binary(context, value) || is_string(context, value);
             case PropertyType::Date:
-                return is_date(context, value) || is_string(context, value);
+                return is_date(context, value) || is_string(context, value) || is_number(context, value) || is_array(context, value);
             case PropertyType::Object:
                 return true;
             case PropertyType::Any:
@@ -455,7 +474,7 @@ inline typename T::Value Value<T>::from_mixed(typename T::Context ctx, const uti
     case type_Bool:
         return from_boolean(ctx, value.get_bool());
     case type_Int:
-        return from_number(ctx, static_cast<double>(value.get_int()));
+        return from_int64(ctx, value.get_int());
     case type_Float:
         return from_number(ctx, value.get_float());
     case type_Double:
@@ -463,7 +482,7 @@ inline typename T::Value Value<T>::from_mixed(typename T::Context ctx, const uti
     case type_Timestamp:
         return from_timestamp(ctx, value.get_timestamp());
     case type_String:
-        return from_string(ctx, value.get_string().data());
+        return from_string(ctx, value.get_string());
     case type_Binary:
         return from_binary(ctx, value.get_binary());
     default:
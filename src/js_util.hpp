@@ -35,14 +35,42 @@ enum class AggregateFunc {
     Avg
 };
 
+// How date properties are exposed to JavaScript (the `dateRepresentation` configuration option).
+enum class DateRepresentation {
+    Date,               // Date objects
+    Milliseconds,       // numbers of milliseconds since the epoch
+    SecondsNanoseconds  // [seconds, nanoseconds] arrays, which keep the full precision of the stored value
+};
+
+// How int properties are exposed to JavaScript (the `integerRepresentation` configuration option).
+enum class IntegerRepresentation {
+    Number,  // numbers, which are exact up to 2^53
+    BigInt   // BigInts, which are exact for every 64-bit value
+};
+
+struct ValueRepresentation {
+    DateRepresentation dates = DateRepresentation::Date;
+    IntegerRepresentation integers = IntegerRepresentation::Number;
+};
+
 template<typename T>
 class RealmDelegate;
 
+template<typename T>
+class NativeAccessor;
+
 template<typename T>
 static inline RealmDelegate<T> *get_delegate(realm::Realm *realm) {
     return static_cast<RealmDelegate<T> *>(realm->m_binding_context.get());
 }
 
+template<typename T>
+static inline void validate_notifications_supported(typename T::Context ctx) {
+    if (!Context<T>::supports_notifications(ctx)) {
+        throw std::runtime_error("Change listeners are not supported in worker threads.");
+    }
+}
+
 template<typename T>
 static inline T stot(const std::string &s) {
     std::istringstream iss(s);
@@ -104,19 +132,19 @@ void compute_aggregate_on_collection(typename T::ContextType ctx, typename T::Ob
         args.validate_maximum(0);
     }
 
-    util::Optional<Mixed> mixed;
+    NativeAccessor<typename T::Type> accessor(ctx, *list);
     switch (func) {
         case AggregateFunc::Min:
-            return_value.set(list->min(column));
+            return_value.set(accessor.box_aggregate(list->min(column)));
             break;
         case AggregateFunc::Max:
-            return_value.set(list->max(column));
+            return_value.set(accessor.box_aggregate(list->max(column)));
             break;
         case AggregateFunc::Sum:
-            return_value.set(list->sum(column));
+            return_value.set(accessor.box_aggregate(list->sum(column)));
             break;
         case AggregateFunc::Avg:
-            return_value.set(list->average(column));
+            return_value.set(accessor.box_aggregate(list->average(column)));
             break;
     }
 }
@@ -34,5 +34,11 @@ inline AbstractExecutionContextID jsc::Context::get_execution_context_id(JSConte
     return reinterpret_cast<AbstractExecutionContextID>(get_global_context(ctx));
 }
 
+template<>
+inline bool jsc::Context::supports_notifications(JSContextRef ctx)
+{
+    return true;
+}
+
 } // js
 } // realm
@@ -24,6 +24,22 @@
 namespace realm {
 namespace js {
 
+template<>
+bool jsc::Value::is_array_buffer_view(JSContextRef ctx, const JSValueRef &value)
+{
+    static jsc::String s_array_buffer = "ArrayBuffer";
+    static jsc::String s_is_view = "isView";
+
+    if (JSObjectRef object = JSValueToObject(ctx, value, nullptr)) {
+        // A TypedArray or DataView, as reported by ArrayBuffer.isView(val).
+        JSObjectRef array_buffer_constructor = jsc::Object::validated_get_constructor(ctx, JSContextGetGlobalObject(ctx), s_array_buffer);
+        JSValueRef is_view = jsc::Object::call_method(ctx, array_buffer_constructor, s_is_view, 1, &object);
+
+        return jsc::Value::to_boolean(ctx, is_view);
+    }
+    return false;
+}
+
 template<>
 bool jsc::Value::is_binary(JSContextRef ctx, const JSValueRef &value)
 {
@@ -114,5 +130,70 @@ OwnedBinaryData jsc::Value::to_binary(JSContextRef ctx, JSValueRef value)
     return OwnedBinaryData(std::move(buffer), byte_count);
 }
 
+#if __APPLE__
+template<>
+const char *jsc::Value::typed_array_type(JSContextRef ctx, const JSValueRef &value)
+{
+    switch (JSValueGetTypedArrayType(ctx, value, nullptr)) {
+        case kJSTypedArrayTypeInt8Array: return "Int8Array";
+        case kJSTypedArrayTypeUint8Array: return "Uint8Array";
+        case kJSTypedArrayTypeUint8ClampedArray: return "Uint8ClampedArray";
+        case kJSTypedArrayTypeInt16Array: return "Int16Array";
+        case kJSTypedArrayTypeUint16Array: return "Uint16Array";
+        case kJSTypedArrayTypeInt32Array: return "Int32Array";
+        case kJSTypedArrayTypeUint32Array: return "Uint32Array";
+        case kJSTypedArrayTypeFloat32Array: return "Float32Array";
+        case kJSTypedArrayTypeFloat64Array: return "Float64Array";
+        default: return nullptr;
+    }
+}
+
+template<>
+BinaryData jsc::Value::typed_array_bytes(JSContextRef ctx, const JSValueRef &value, OwnedBinaryData &)
+{
+    JSObjectRef object = JSValueToObject(ctx, value, nullptr);
+    // The pointer is to the start of the buffer rather than of the view.
+    auto bytes = static_cast<const char *>(JSObjectGetTypedArrayBytesPtr(ctx, object, nullptr));
+    return BinaryData(bytes + JSObjectGetTypedArrayByteOffset(ctx, object, nullptr), JSObjectGetTypedArrayByteLength(ctx, object, nullptr));
+}
+#else
+// The JavaScriptCore headers the Android build uses predate the typed array API.
+template<>
+const char *jsc::Value::typed_array_type(JSContextRef ctx, const JSValueRef &value)
+{
+    static jsc::String s_object = "Object";
+    static jsc::String s_prototype = "prototype";
+    static jsc::String s_to_string = "toString";
+    static jsc::String s_call = "call";
+    static const char *const s_types[] = {
+        "Int8Array", "Uint8Array", "Uint8ClampedArray", "Int16Array", "Uint16Array",
+        "Int32Array", "Uint32Array", "Float32Array", "Float64Array",
+    };
+
+    if (!JSValueIsObject(ctx, value)) {
+        return nullptr;
+    }
+
+    // Object.prototype.toString() names the type a TypedArray was created as, whatever its prototype.
+    JSObjectRef object_constructor = jsc::Object::validated_get_constructor(ctx, JSContextGetGlobalObject(ctx), s_object);
+    JSObjectRef object_prototype = jsc::Object::validated_get_object(ctx, object_constructor, s_prototype);
+    JSObjectRef to_string = jsc::Object::validated_get_object(ctx, object_prototype, s_to_string);
+    std::string tag = jsc::Value::to_string(ctx, jsc::Object::call_method(ctx, to_string, s_call, 1, &value));
+    for (auto type : s_types) {
+        if (tag == util::format("[object %1]", type)) {
+            return type;
+        }
+    }
+    return nullptr;
+}
+
+template<>
+BinaryData jsc::Value::typed_array_bytes(JSContextRef ctx, const JSValueRef &value, OwnedBinaryData &storage)
+{
+    storage = jsc::Value::to_binary(ctx, value);
+    return storage.get();
+}
+#endif
+
 } // namespace js
 } // namespace realm
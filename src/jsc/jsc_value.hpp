@@ -97,6 +97,12 @@ inline bool jsc::Value::is_number(JSContextRef ctx, const JSValueRef &value) {
     return JSValueIsNumber(ctx, value);
 }
 
+template<>
+inline bool jsc::Value::is_bigint(JSContextRef ctx, const JSValueRef &value) {
+    // The JavaScriptCore C API has no BigInt support.
+    return false;
+}
+
 template<>
 inline bool jsc::Value::is_object(JSContextRef ctx, const JSValueRef &value) {
     return JSValueIsObject(ctx, value);
@@ -107,6 +113,9 @@ inline bool jsc::Value::is_string(JSContextRef ctx, const JSValueRef &value) {
     return JSValueIsString(ctx, value);
 }
 
+template<>
+bool jsc::Value::is_array_buffer_view(JSContextRef ctx, const JSValueRef &value);
+
 template<>
 bool jsc::Value::is_binary(JSContextRef ctx, const JSValueRef &value);
 
@@ -135,11 +144,38 @@ inline JSValueRef jsc::Value::from_number(JSContextRef ctx, double number) {
     return JSValueMakeNumber(ctx, number);
 }
 
+template<>
+inline JSValueRef jsc::Value::from_int64(JSContextRef ctx, int64_t number) {
+    return JSValueMakeNumber(ctx, number);
+}
+
+template<>
+inline JSValueRef jsc::Value::from_bigint(JSContextRef ctx, int64_t number) {
+    throw std::runtime_error("BigInt is not supported by JavaScriptCore.");
+}
+
 template<>
 inline JSValueRef jsc::Value::from_nonnull_string(JSContextRef ctx, const jsc::String &string) {
     return JSValueMakeString(ctx, string);
 }
 
+template<>
+inline JSValueRef jsc::Value::from_nonnull_string_data(JSContextRef ctx, StringData data) {
+    // ASCII maps directly onto UTF-16 code units, which skips the UTF-8 decoder and the null-terminated copy.
+    std::vector<JSChar> characters(data.size());
+    for (size_t i = 0; i < data.size(); i++) {
+        unsigned char c = data[i];
+        if (c & 0x80) {
+            return JSValueMakeString(ctx, jsc::String(std::string(data.data(), data.size())));
+        }
+        characters[i] = c;
+    }
+    JSStringRef string = JSStringCreateWithCharacters(characters.data(), characters.size());
+    JSValueRef value = JSValueMakeString(ctx, string);
+    JSStringRelease(string);
+    return value;
+}
+
 template<>
 inline JSValueRef jsc::Value::from_undefined(JSContextRef ctx) {
     return JSValueMakeUndefined(ctx);
@@ -166,6 +202,20 @@ inline jsc::String jsc::Value::to_string(JSContextRef ctx, const JSValueRef &val
     return string;
 }
 
+template<>
+inline void jsc::Value::to_string(JSContextRef ctx, const JSValueRef &value, std::string &buffer) {
+    JSValueRef exception = nullptr;
+    JSStringRef string = JSValueToStringCopy(ctx, value, &exception);
+    if (exception) {
+        throw jsc::Exception(ctx, exception);
+    }
+
+    size_t max_size = JSStringGetMaximumUTF8CStringSize(string);
+    buffer.resize(max_size);
+    buffer.resize(JSStringGetUTF8CString(string, &buffer[0], max_size) - 1);
+    JSStringRelease(string);
+}
+
 template<>
 inline double jsc::Value::to_number(JSContextRef ctx, const JSValueRef &value) {
     JSValueRef exception = nullptr;
@@ -180,6 +230,20 @@ inline double jsc::Value::to_number(JSContextRef ctx, const JSValueRef &value) {
     return number;
 }
 
+template<>
+inline int64_t jsc::Value::to_int64(JSContextRef ctx, const JSValueRef &value) {
+    double number = to_number(ctx, value);
+    if (!(number >= -9223372036854775808.0 && number < 9223372036854775808.0)) {
+        throw std::out_of_range(util::format("Value '%1' does not fit in a 64-bit integer.",
+                                             (std::string)to_string(ctx, value)));
+    }
+    return static_cast<int64_t>(number);
+}
+
+template<>
+inline int64_t jsc::Value::to_bigint(JSContextRef ctx, const JSValueRef &value) {
+    throw std::runtime_error("BigInt is not supported by JavaScriptCore.");
+}
 
 template<>
 inline JSObjectRef jsc::Value::to_object(JSContextRef ctx, const JSValueRef &value) {
@@ -223,5 +287,11 @@ inline JSObjectRef jsc::Value::to_function(JSContextRef ctx, const JSValueRef &v
 template<>
 OwnedBinaryData jsc::Value::to_binary(JSContextRef ctx, JSValueRef value);
 
+template<>
+const char *jsc::Value::typed_array_type(JSContextRef ctx, const JSValueRef &value);
+
+template<>
+BinaryData jsc::Value::typed_array_bytes(JSContextRef ctx, const JSValueRef &value, OwnedBinaryData &storage);
+
 } // js
 } // realm
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace realm {
+namespace js {
+namespace list_diff {
+
+// Shortest edit scripts between two sequences, used to turn the contents of a list into new contents
+// with as few writes (and so as small change sets) as possible.
+
+enum class Edit : unsigned char {
+    Keep,   // the next element of both sequences is the same
+    Remove, // the next element of the old sequence isn't in the new one
+    Insert, // the next element of the new sequence isn't in the old one
+};
+
+// Edit scripts longer than this aren't searched for; the differing part of the sequences is replaced
+// as a whole instead. This bounds the time and the memory (quadratic in the number of edits) needed.
+constexpr size_t default_max_edits = 1000;
+
+namespace _impl {
+
+// Myers' O((N+M)D) algorithm ("An O(ND) Difference Algorithm and Its Variations", 1986) on
+// from[0, n) and to[0, m), appending the edits to `script`.
+template<typename Key>
+void append_edits(const Key *from, long n, const Key *to, long m, size_t max_edits, std::vector<Edit> &script) {
+    long max = n + m;
+    std::vector<long> v(2 * max + 2);
+    long offset = max;
+    // trace[d] holds the furthest x reached on each diagonal -d...d before step d.
+    std::vector<std::vector<long>> trace;
+
+    long edits = -1;
+    for (long d = 0; d <= max && edits < 0; d++) {
+        if (size_t(d) > max_edits) {
+            script.insert(script.end(), n, Edit::Remove);
+            script.insert(script.end(), m, Edit::Insert);
+            return;
+        }
+        trace.emplace_back(v.begin() + offset - d, v.begin() + offset + d + 1);
+
+        for (long k = -d; k <= d; k += 2) {
+            long x = k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1]) ? v[offset + k + 1] : v[offset + k - 1] + 1;
+            long y = x - k;
+            while (x < n && y < m && from[x] == to[y]) {
+                x++;
+                y++;
+            }
+            v[offset + k] = x;
+            if (x >= n && y >= m) {
+                edits = d;
+                break;
+            }
+        }
+    }
+
+    std::vector<Edit> reversed;
+    long x = n, y = m;
+    for (long d = edits; d > 0; d--) {
+        auto &previous = trace[d];
+        long k = x - y;
+        bool down = k == -d || (k != d && previous[k - 1 + d] < previous[k + 1 + d]);
+        long previous_k = down ? k + 1 : k - 1;
+        long previous_x = previous[previous_k + d];
+        long previous_y = previous_x - previous_k;
+        while (x > previous_x && y > previous_y) {
+            reversed.push_back(Edit::Keep);
+            x--;
+            y--;
+        }
+        reversed.push_back(down ? Edit::Insert : Edit::Remove);
+        x = previous_x;
+        y = previous_y;
+    }
+    reversed.insert(reversed.end(), x, Edit::Keep);
+    script.insert(script.end(), reversed.rbegin(), reversed.rend());
+}
+
+} // namespace _impl
+
+// Returns a shortest edit script turning `from` into `to`.
+template<typename Key>
+std::vector<Edit> compute(const std::vector<Key> &from, const std::vector<Key> &to, size_t max_edits = default_max_edits) {
+    size_t n = from.size(), m = to.size();
+    size_t prefix = 0;
+    while (prefix < n && prefix < m && from[prefix] == to[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < n - prefix && suffix < m - prefix && from[n - suffix - 1] == to[m - suffix - 1]) {
+        suffix++;
+    }
+
+    std::vector<Edit> script(prefix, Edit::Keep);
+    _impl::append_edits(from.data() + prefix, long(n - prefix - suffix), to.data() + prefix, long(m - prefix - suffix), max_edits, script);
+    script.insert(script.end(), suffix, Edit::Keep);
+    return script;
+}
+
+// Applies `script` to a list, given functions which remove the element at a position, and insert or
+// set the element at a position to the element at an index of the new sequence. An element which is
+// removed where another is inserted is set instead.
+template<typename Remove, typename Insert, typename Set>
+void apply(const std::vector<Edit> &script, Remove &&remove, Insert &&insert, Set &&set) {
+    size_t position = 0, index = 0;
+    for (size_t i = 0; i < script.size();) {
+        if (script[i] == Edit::Keep) {
+            position++;
+            index++;
+            i++;
+            continue;
+        }
+
+        size_t removals = 0, insertions = 0;
+        for (; i < script.size() && script[i] != Edit::Keep; i++) {
+            (script[i] == Edit::Remove ? removals : insertions)++;
+        }
+
+        size_t replacements = std::min(removals, insertions);
+        for (size_t j = 0; j < replacements; j++) {
+            set(position++, index++);
+        }
+        for (size_t j = replacements; j < removals; j++) {
+            remove(position);
+        }
+        for (size_t j = replacements; j < insertions; j++) {
+            insert(position++, index++);
+        }
+    }
+}
+
+} // namespace list_diff
+} // namespace js
+} // namespace realm
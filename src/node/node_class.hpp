@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include "node_isolate_data.hpp"
 #include "node_types.hpp"
 
 #include "js_class.hpp"
@@ -46,8 +47,12 @@ class ObjectWrap : public Nan::ObjectWrap {
     static v8::Local<v8::Function> create_constructor(v8::Isolate*);
     static v8::Local<v8::Object> create_instance(v8::Isolate*, Internal* = nullptr);
 
+    // Templates belong to the isolate they were created in, so each isolate gets its own.
     static v8::Local<v8::FunctionTemplate> get_template() {
-        static Nan::Persistent<v8::FunctionTemplate> js_template(create_template());
+        auto &js_template = IsolateData::get(v8::Isolate::GetCurrent()).function_template(&s_class);
+        if (js_template.IsEmpty()) {
+            js_template.Reset(create_template());
+        }
         return Nan::New(js_template);
     }
 
@@ -69,6 +74,7 @@ class ObjectWrap : public Nan::ObjectWrap {
     }
 
   private:
+    // Only holds the names and callbacks of the class's members, which are the same in every isolate.
     static ClassType s_class;
 
     std::unique_ptr<Internal> m_object;
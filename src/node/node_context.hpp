@@ -34,5 +34,17 @@ inline AbstractExecutionContextID node::Context::get_execution_context_id(v8::Is
     return reinterpret_cast<AbstractExecutionContextID>(isolate);
 }
 
+// The object store signals change notifications on the default loop, which only the main thread runs,
+// so they can't be delivered to a worker thread.
+template<>
+inline bool node::Context::supports_notifications(v8::Isolate* isolate)
+{
+#if NODE_MODULE_VERSION >= 64
+    return ::node::GetCurrentEventLoop(isolate) == uv_default_loop();
+#else
+    return true;
+#endif
+}
+
 } // js
 } // realm
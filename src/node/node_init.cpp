@@ -32,4 +32,12 @@ static void init(v8::Local<v8::Object> exports) {
 } // node
 } // realm
 
+#ifdef NODE_MODULE_INIT
+// Context-aware, so that the module can also be loaded by worker threads, each of which has its own
+// instances of the classes (see IsolateData).
+NODE_MODULE_INIT(/* exports, module, context */) {
+    realm::node::init(exports);
+}
+#else
 NODE_MODULE(Realm, realm::node::init);
+#endif
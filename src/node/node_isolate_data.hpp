@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "node_types.hpp"
+
+namespace realm {
+namespace node {
+
+// The state of the addon which belongs to one V8 isolate, such as the function templates of the
+// classes it exports. Node runs the main thread and each worker thread in isolates of their own, and
+// handles must not be used outside the isolate that created them, so this state can't be static.
+//
+// V8's data slots on the isolate are taken by Node itself, so the state is looked up in a table of the
+// thread instead. An isolate is only ever entered by the thread that Node created it on.
+class IsolateData {
+  public:
+    static IsolateData &get(v8::Isolate *isolate) {
+        auto &isolates = thread_isolates();
+        auto &data = isolates[isolate];
+        if (!data) {
+            data.reset(new IsolateData);
+#if NODE_MODULE_VERSION >= 64
+            // Worker threads are torn down while their process keeps running.
+            ::node::AddEnvironmentCleanupHook(isolate, [](void *isolate) {
+                thread_isolates().erase(static_cast<v8::Isolate *>(isolate));
+            }, isolate);
+#endif
+        }
+        return *data;
+    }
+
+    // The function template of the class identified by `key`, which is empty until it is created.
+    Nan::Persistent<v8::FunctionTemplate> &function_template(const void *key) {
+        return m_function_templates[key];
+    }
+
+  private:
+    std::unordered_map<const void *, Nan::Persistent<v8::FunctionTemplate>> m_function_templates;
+
+    static std::unordered_map<v8::Isolate *, std::unique_ptr<IsolateData>> &thread_isolates() {
+        thread_local std::unordered_map<v8::Isolate *, std::unique_ptr<IsolateData>> isolates;
+        return isolates;
+    }
+};
+
+} // node
+} // realm
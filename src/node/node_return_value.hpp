@@ -65,7 +65,7 @@ class ReturnValue<node::Types> {
         m_value.Set(number);
     }
     void set(realm::Mixed mixed) {
-        m_value.Set(Value<node::Types>::from_mixed(nullptr, mixed));
+        m_value.Set(Value<node::Types>::from_mixed(m_value.GetIsolate(), mixed));
     }
     void set_null() {
         m_value.SetNull();
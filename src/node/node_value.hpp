@@ -18,15 +18,34 @@
 
 #pragma once
 
+#include <limits>
+
 #include "node_types.hpp"
 
+// BigInt is available from V8 6.7 (Node.js 10.4).
+#if V8_MAJOR_VERSION > 6 || (V8_MAJOR_VERSION == 6 && V8_MINOR_VERSION >= 7)
+#define REALM_NODE_HAS_BIGINT 1
+#else
+#define REALM_NODE_HAS_BIGINT 0
+#endif
+
 namespace realm {
 namespace js {
 
+template<>
+inline bool node::Value::is_bigint(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
+#if REALM_NODE_HAS_BIGINT
+    return value->IsBigInt();
+#else
+    return false;
+#endif
+}
+
 template<>
 inline const char *node::Value::typeof(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
     if (value->IsNull()) { return "null"; }
     if (value->IsNumber()) { return "number"; }
+    if (is_bigint(isolate, value)) { return "bigint"; }
     if (value->IsString()) { return "string"; }
     if (value->IsBoolean()) { return "boolean"; }
     if (value->IsUndefined()) { return "undefined"; }
@@ -120,11 +139,88 @@ inline v8::Local<v8::Value> node::Value::from_number(v8::Isolate* isolate, doubl
     return Nan::New(number);
 }
 
+template<>
+inline v8::Local<v8::Value> node::Value::from_int64(v8::Isolate* isolate, int64_t number) {
+    // Small integers are stored as SMIs without going through a double.
+    if (number >= std::numeric_limits<int32_t>::min() && number <= std::numeric_limits<int32_t>::max()) {
+        return v8::Integer::New(isolate, static_cast<int32_t>(number));
+    }
+    return v8::Number::New(isolate, static_cast<double>(number));
+}
+
+template<>
+inline v8::Local<v8::Value> node::Value::from_bigint(v8::Isolate* isolate, int64_t number) {
+#if REALM_NODE_HAS_BIGINT
+    return v8::BigInt::New(isolate, number);
+#else
+    throw std::runtime_error("BigInt is not supported by this version of Node.js.");
+#endif
+}
+
 template<>
 inline v8::Local<v8::Value> node::Value::from_nonnull_string(v8::Isolate* isolate, const node::String &string) {
     return v8::Local<v8::String>(string);
 }
 
+namespace node {
+
+// Strings at least this long are handed to V8 as external strings, so that V8 doesn't have to copy them
+// into (and later move them around) the managed heap.
+static const size_t external_string_threshold = 64 * 1024;
+
+class ExternalOneByteString : public v8::String::ExternalOneByteStringResource {
+  public:
+    ExternalOneByteString(const char* data, size_t length) : m_data(new char[length]), m_length(length) {
+        memcpy(m_data.get(), data, length);
+    }
+
+    const char* data() const override { return m_data.get(); }
+    size_t length() const override { return m_length; }
+
+  private:
+    std::unique_ptr<char[]> m_data;
+    size_t m_length;
+};
+
+static inline bool is_ascii(const char* data, size_t length) {
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        if (word & 0x8080808080808080ULL) {
+            return false;
+        }
+    }
+    for (; i < length; i++) {
+        if (data[i] & 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // node
+
+template<>
+inline v8::Local<v8::Value> node::Value::from_nonnull_string_data(v8::Isolate* isolate, StringData string) {
+    int length = static_cast<int>(string.size());
+
+    // ASCII is valid Latin-1, so V8 can take it as a one-byte string without decoding UTF-8.
+    if (node::is_ascii(string.data(), string.size())) {
+        if (string.size() >= node::external_string_threshold) {
+            auto resource = new node::ExternalOneByteString(string.data(), string.size());
+            v8::Local<v8::String> external;
+            if (v8::String::NewExternalOneByte(isolate, resource).ToLocal(&external)) {
+                return external;
+            }
+            delete resource;
+        }
+        return v8::String::NewFromOneByte(isolate, reinterpret_cast<const uint8_t*>(string.data()),
+                                          v8::NewStringType::kNormal, length).ToLocalChecked();
+    }
+    return v8::String::NewFromUtf8(isolate, string.data(), v8::NewStringType::kNormal, length).ToLocalChecked();
+}
+
 template<>
 inline v8::Local<v8::Value> node::Value::from_nonnull_binary(v8::Isolate* isolate, BinaryData data) {
     v8::Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(isolate, data.size());
@@ -152,6 +248,24 @@ inline node::String node::Value::to_string(v8::Isolate* isolate, const v8::Local
     return value->ToString();
 }
 
+template<>
+inline void node::Value::to_string(v8::Isolate* isolate, const v8::Local<v8::Value> &value, std::string &buffer) {
+    v8::Local<v8::String> string = value->ToString();
+
+    // Most strings are one-byte internally; if they're also ASCII the bytes can be copied as they are.
+    if (string->IsOneByte()) {
+        buffer.resize(string->Length());
+        string->WriteOneByte(reinterpret_cast<uint8_t*>(&buffer[0]), 0, -1, v8::String::NO_NULL_TERMINATION);
+        if (node::is_ascii(buffer.data(), buffer.size())) {
+            return;
+        }
+    }
+
+    buffer.resize(string->Utf8Length());
+    string->WriteUtf8(&buffer[0], static_cast<int>(buffer.size()), nullptr,
+                      v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8);
+}
+
 template<>
 inline double node::Value::to_number(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
     double number = Nan::To<double>(value).FromMaybe(NAN);
@@ -162,6 +276,34 @@ inline double node::Value::to_number(v8::Isolate* isolate, const v8::Local<v8::V
     return number;
 }
 
+template<>
+inline int64_t node::Value::to_int64(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
+    if (value->IsInt32()) {
+        return value.As<v8::Int32>()->Value();
+    }
+    double number = to_number(isolate, value);
+    if (!(number >= -9223372036854775808.0 && number < 9223372036854775808.0)) {
+        throw std::out_of_range(util::format("Value '%1' does not fit in a 64-bit integer.",
+                                             (std::string)to_string(isolate, value)));
+    }
+    return static_cast<int64_t>(number);
+}
+
+template<>
+inline int64_t node::Value::to_bigint(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
+#if REALM_NODE_HAS_BIGINT
+    bool lossless = false;
+    int64_t number = value.As<v8::BigInt>()->Int64Value(&lossless);
+    if (!lossless) {
+        throw std::out_of_range(util::format("Value '%1' does not fit in a 64-bit integer.",
+                                             (std::string)to_string(isolate, value)));
+    }
+    return number;
+#else
+    throw std::runtime_error("BigInt is not supported by this version of Node.js.");
+#endif
+}
+
 template<>
 inline OwnedBinaryData node::Value::to_binary(v8::Isolate* isolate, v8::Local<v8::Value> value) {
     // Make a non-null OwnedBinaryData, even when `data` is nullptr.
@@ -194,6 +336,45 @@ inline OwnedBinaryData node::Value::to_binary(v8::Isolate* isolate, v8::Local<v8
     }
 }
 
+template<>
+inline const char *node::Value::typed_array_type(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
+    if (value->IsInt8Array()) {
+        return "Int8Array";
+    }
+    if (value->IsUint8Array()) {
+        return "Uint8Array";
+    }
+    if (value->IsUint8ClampedArray()) {
+        return "Uint8ClampedArray";
+    }
+    if (value->IsInt16Array()) {
+        return "Int16Array";
+    }
+    if (value->IsUint16Array()) {
+        return "Uint16Array";
+    }
+    if (value->IsInt32Array()) {
+        return "Int32Array";
+    }
+    if (value->IsUint32Array()) {
+        return "Uint32Array";
+    }
+    if (value->IsFloat32Array()) {
+        return "Float32Array";
+    }
+    if (value->IsFloat64Array()) {
+        return "Float64Array";
+    }
+    return nullptr;
+}
+
+template<>
+inline BinaryData node::Value::typed_array_bytes(v8::Isolate* isolate, const v8::Local<v8::Value> &value, OwnedBinaryData &) {
+    v8::Local<v8::TypedArray> typed_array = value.As<v8::TypedArray>();
+    v8::ArrayBuffer::Contents contents = typed_array->Buffer()->GetContents();
+    return BinaryData(static_cast<const char*>(contents.Data()) + typed_array->ByteOffset(), typed_array->ByteLength());
+}
+
 template<>
 inline v8::Local<v8::Object> node::Value::to_object(v8::Isolate* isolate, const v8::Local<v8::Value> &value) {
     return Nan::To<v8::Object>(value).FromMaybe(v8::Local<v8::Object>());
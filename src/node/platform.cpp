@@ -18,6 +18,7 @@
 
 #include <stdexcept>
 #include <vector>
+#include <node.h>
 #include <uv.h>
 
 #include "../platform.hpp"
@@ -40,6 +41,17 @@ struct FileSystemRequest : uv_fs_t {
     }
 };
 
+// The file system calls are synchronous, but are made on the loop of the thread making them, which
+// isn't the default loop in worker threads.
+static uv_loop_t* current_loop() {
+#if NODE_MODULE_VERSION >= 64
+    if (v8::Isolate* isolate = v8::Isolate::GetCurrent()) {
+        return ::node::GetCurrentEventLoop(isolate);
+    }
+#endif
+    return uv_default_loop();
+}
+
 // taken from Node.js: function Cwd in node.cc
 std::string default_realm_file_directory()
 {
@@ -72,7 +84,7 @@ void ensure_directory_exists_for_file(const std::string &file_path)
 
         std::string dir_path = file_path.substr(0, pos++);
         FileSystemRequest req;
-        if (uv_fs_mkdir(uv_default_loop(), &req, dir_path.c_str(), 0755, nullptr) < 0 && req.result != UV_EEXIST) {
+        if (uv_fs_mkdir(current_loop(), &req, dir_path.c_str(), 0755, nullptr) < 0 && req.result != UV_EEXIST) {
             throw UVException(static_cast<uv_errno_t>(req.result));
         }
     }
@@ -90,7 +102,7 @@ inline bool ends_with(const std::string& str, const std::string& suffix) {
 void remove_realm_files_from_directory(const std::string &dir_path)
 {
     FileSystemRequest scandir_req;
-    if (uv_fs_scandir(uv_default_loop(), &scandir_req, dir_path.c_str(), 0, nullptr) < 0) {
+    if (uv_fs_scandir(current_loop(), &scandir_req, dir_path.c_str(), 0, nullptr) < 0) {
         throw UVException(static_cast<uv_errno_t>(scandir_req.result));
     }
 
@@ -103,20 +115,20 @@ void remove_realm_files_from_directory(const std::string &dir_path)
             if (ends_with(path, realm_management_extension)) {
                 uv_dirent_t management_entry;
                 FileSystemRequest management_scandir_req;
-                if (uv_fs_scandir(uv_default_loop(), &management_scandir_req, path.c_str(), 0, nullptr) < 0) {
+                if (uv_fs_scandir(current_loop(), &management_scandir_req, path.c_str(), 0, nullptr) < 0) {
                     throw UVException(static_cast<uv_errno_t>(scandir_req.result));
                 }
 
                 while (uv_fs_scandir_next(&management_scandir_req, &management_entry) != UV_EOF) {
                     std::string management_entry_path = path + '/' + management_entry.name;
                     FileSystemRequest delete_req;
-                    if (uv_fs_unlink(uv_default_loop(), &delete_req, management_entry_path.c_str(), nullptr) != 0) {
+                    if (uv_fs_unlink(current_loop(), &delete_req, management_entry_path.c_str(), nullptr) != 0) {
                         throw UVException(static_cast<uv_errno_t>(delete_req.result));
                     }
                 }
 
                 FileSystemRequest management_rmdir_req;
-                if (uv_fs_rmdir(uv_default_loop(), &management_rmdir_req, path.c_str(), nullptr)) {
+                if (uv_fs_rmdir(current_loop(), &management_rmdir_req, path.c_str(), nullptr)) {
                     throw UVException(static_cast<uv_errno_t>(management_rmdir_req.result));
                 }
             }
@@ -126,7 +138,7 @@ void remove_realm_files_from_directory(const std::string &dir_path)
             static std::string realm_lock_extension(".realm.lock");
             if (ends_with(path, realm_extension) || ends_with(path, realm_note_extension) || ends_with(path, realm_lock_extension)) {
                 FileSystemRequest delete_req;
-                if (uv_fs_unlink(uv_default_loop(), &delete_req, path.c_str(), nullptr) != 0) {
+                if (uv_fs_unlink(current_loop(), &delete_req, path.c_str(), nullptr) != 0) {
                     throw UVException(static_cast<uv_errno_t>(delete_req.result));
                 }
             }
@@ -137,7 +149,7 @@ void remove_realm_files_from_directory(const std::string &dir_path)
 void remove_directory(const std::string &path)
 {
     FileSystemRequest exists_req;
-    if (uv_fs_stat(uv_default_loop(), &exists_req, path.c_str(), nullptr) != 0) {
+    if (uv_fs_stat(current_loop(), &exists_req, path.c_str(), nullptr) != 0) {
         if (exists_req.result == UV_ENOENT) {
             // path doesn't exist, ignore
             return;
@@ -148,20 +160,20 @@ void remove_directory(const std::string &path)
 
     uv_dirent_t dir_entry;
     FileSystemRequest dir_scan_req;
-    if (uv_fs_scandir(uv_default_loop(), &dir_scan_req, path.c_str(), 0, nullptr) < 0) {
+    if (uv_fs_scandir(current_loop(), &dir_scan_req, path.c_str(), 0, nullptr) < 0) {
         throw UVException(static_cast<uv_errno_t>(dir_scan_req.result));
     }
 
     while (uv_fs_scandir_next(&dir_scan_req, &dir_entry) != UV_EOF) {
         std::string dir_entry_path = path + '/' + dir_entry.name;
         FileSystemRequest delete_req;
-        if (uv_fs_unlink(uv_default_loop(), &delete_req, dir_entry_path.c_str(), nullptr) != 0) {
+        if (uv_fs_unlink(current_loop(), &delete_req, dir_entry_path.c_str(), nullptr) != 0) {
             throw UVException(static_cast<uv_errno_t>(delete_req.result));
         }
     }
 
     FileSystemRequest rmdir_req;
-    if (uv_fs_rmdir(uv_default_loop(), &rmdir_req, path.c_str(), nullptr)) {
+    if (uv_fs_rmdir(current_loop(), &rmdir_req, path.c_str(), nullptr)) {
         throw UVException(static_cast<uv_errno_t>(rmdir_req.result));
     }
 }
@@ -170,7 +182,7 @@ void remove_directory(const std::string &path)
 void remove_file(const std::string &path)
 {
     FileSystemRequest exists_req;
-    if (uv_fs_stat(uv_default_loop(), &exists_req, path.c_str(), nullptr) != 0) {
+    if (uv_fs_stat(current_loop(), &exists_req, path.c_str(), nullptr) != 0) {
         if (exists_req.result == UV_ENOENT) {
             // path doesn't exist, ignore
             return;
@@ -180,7 +192,7 @@ void remove_file(const std::string &path)
     }
 
     FileSystemRequest delete_req;
-    if (uv_fs_unlink(uv_default_loop(), &delete_req, path.c_str(), nullptr) != 0) {
+    if (uv_fs_unlink(current_loop(), &delete_req, path.c_str(), nullptr) != 0) {
         throw UVException(static_cast<uv_errno_t>(delete_req.result));
     }
 }
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <realm/query.hpp>
+#include <realm/table_view.hpp>
+
+#include "results.hpp"
+#include "shared_realm.hpp"
+#include "thread_pool.hpp"
+#include "thread_safe_reference.hpp"
+
+namespace realm {
+namespace js {
+namespace parallel_query {
+
+// Evaluation of queries over a whole table by several threads, each of which evaluates the query over
+// a range of the rows. Accessors of a Realm must only be used by one thread, so each thread resolves a
+// thread safe reference to the query in a Realm instance of its own. The references all pin the
+// version the calling Realm is at, so that every range is evaluated at that same version.
+
+namespace _impl {
+
+inline ThreadPool &thread_pool() {
+    static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u));
+    return pool;
+}
+
+// The configuration of the Realm instances opened by the threads. Whatever runs JavaScript is left
+// out: the file's schema is used as it is, and it has already been migrated by the calling Realm.
+inline Realm::Config worker_config(const Realm::Config &config) {
+    Realm::Config worker_config = config;
+    worker_config.cache = false;
+    worker_config.schema = util::none;
+    worker_config.migration_function = nullptr;
+    worker_config.initialization_function = nullptr;
+    worker_config.should_compact_on_launch_function = nullptr;
+    worker_config.automatic_change_notifications = false;
+    return worker_config;
+}
+
+// Appends `rows` to `table_view`. Core has no public way of making a TableView of given rows, but the
+// row indexes of a view are the public m_row_indexes column of RowIndexes, its base class, in the core
+// this is built against (REALM_CORE_VERSION in dependencies.list). This must be checked again when
+// core is updated.
+inline void add_rows(TableView &table_view, const std::vector<size_t> &rows) {
+    for (size_t row : rows) {
+        table_view.m_row_indexes.add(row);
+    }
+}
+
+} // namespace _impl
+
+// Returns a snapshot of the objects of `results`, a Results of all of the objects of a table filtered
+// by a query, evaluated in up to `partitions` ranges of rows in parallel. The rows are in table order,
+// as they would be if the query were evaluated by one thread.
+//
+// The Realm of `results` must not be in a write transaction, since other Realm instances can't see
+// the changes made in it.
+inline realm::Results find_all(const realm::Results &results, size_t partitions) {
+    SharedRealm realm = results.get_realm();
+    Query query = results.get_query();
+    size_t size = query.get_table()->size();
+    partitions = std::min(partitions, size);
+    if (partitions < 2) {
+        return results.snapshot();
+    }
+
+    // Each task evaluates the partitions it takes in a Realm instance of its own, which is opened once
+    // for the query and closed when the task is done, so that no instance outlives the query.
+    auto config = _impl::worker_config(realm->config());
+    size_t task_count = std::min(partitions, _impl::thread_pool().size());
+    std::atomic<size_t> next_partition(0);
+    std::vector<std::vector<size_t>> partition_rows(partitions);
+    // The references are all obtained before any task is submitted, as the tasks use the state above.
+    std::vector<std::shared_ptr<ThreadSafeReference<realm::Results>>> references;
+    for (size_t i = 0; i < task_count; i++) {
+        references.push_back(std::make_shared<ThreadSafeReference<realm::Results>>(realm->obtain_thread_safe_reference(results)));
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve(task_count);
+    for (auto &reference : references) {
+        futures.push_back(_impl::thread_pool().submit([=, &next_partition, &partition_rows] {
+            auto task_realm = Realm::get_shared_realm(config);
+            try {
+                // Resolving the reference without a read transaction begins one at the pinned version,
+                // rather than advancing the reference to the version the Realm was opened at.
+                task_realm->invalidate();
+                auto task_results = task_realm->resolve_thread_safe_reference(std::move(*reference));
+                Query task_query = task_results.get_query();
+                for (size_t j = next_partition++; j < partitions; j = next_partition++) {
+                    TableView table_view = task_query.find_all(size * j / partitions, size * (j + 1) / partitions);
+                    auto &rows = partition_rows[j];
+                    rows.reserve(table_view.size());
+                    for (size_t k = 0; k < table_view.size(); k++) {
+                        rows.push_back(table_view.get_source_ndx(k));
+                    }
+                }
+            }
+            catch (...) {
+                task_realm->close();
+                throw;
+            }
+            task_realm->close();
+        }));
+    }
+
+    // Every task is waited for before throwing, so that no task outlives the call.
+    std::exception_ptr exception;
+    for (auto &future : futures) {
+        try {
+            future.get();
+        }
+        catch (...) {
+            exception = exception ? exception : std::current_exception();
+        }
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+    // A view of no rows which knows its query and table, to which the rows of the partitions are added.
+    TableView table_view = query.find_all(0, 0);
+    for (auto &rows : partition_rows) {
+        _impl::add_rows(table_view, rows);
+    }
+    return realm::Results(realm, std::move(table_view)).snapshot();
+}
+
+} // namespace parallel_query
+} // namespace js
+} // namespace realm
@@ -0,0 +1,288 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+#include <realm/parser/parser.hpp>
+#include <realm/query.hpp>
+#include <realm/query_expression.hpp>
+#include <realm/util/format.hpp>
+
+#include "property.hpp"
+
+namespace realm {
+namespace js {
+namespace primitive_query_builder {
+
+// Builds queries over Lists and Results of primitive values from parsed predicates. The values are
+// stored in the only column of a table of their own, and predicates refer to them as `self`, as in
+// `self > 5 AND self != $0`.
+
+namespace _impl {
+
+using parser::Expression;
+using parser::Predicate;
+
+// The value stored in a primitive list is always in the first column of its table.
+constexpr size_t value_column = 0;
+
+inline BinaryData binary_data(const std::string &data) { return BinaryData(data.data(), data.size()); }
+inline BinaryData binary_data(BinaryData data) { return data; }
+
+inline bool is_self(const Expression &expression) {
+    return expression.type == Expression::Type::KeyPath && expression.s == "self";
+}
+
+inline size_t argument_index(const Expression &expression) {
+    return std::stoul(expression.s);
+}
+
+// The operator to use when the operands of a comparison are swapped so that `self` comes first.
+inline Predicate::Operator flipped(Predicate::Operator op) {
+    switch (op) {
+        case Predicate::Operator::LessThan: return Predicate::Operator::GreaterThan;
+        case Predicate::Operator::LessThanOrEqual: return Predicate::Operator::GreaterThanOrEqual;
+        case Predicate::Operator::GreaterThan: return Predicate::Operator::LessThan;
+        case Predicate::Operator::GreaterThanOrEqual: return Predicate::Operator::LessThanOrEqual;
+        default: return op;
+    }
+}
+
+[[noreturn]] inline void unsupported_operator(PropertyType type) {
+    throw std::invalid_argument(util::format("Unsupported operator for lists of type '%1'.", string_for_property_type(type)));
+}
+
+template<typename U> U parse_number(const std::string &s, size_t *parsed);
+template<> inline int64_t parse_number(const std::string &s, size_t *parsed) { return std::stoll(s, parsed); }
+template<> inline float parse_number(const std::string &s, size_t *parsed) { return std::stof(s, parsed); }
+template<> inline double parse_number(const std::string &s, size_t *parsed) { return std::stod(s, parsed); }
+
+// Number literals must be numbers of the list's type as a whole, and in its range.
+template<typename U>
+U parse_literal(const Expression &value, PropertyType type) {
+    size_t parsed = 0;
+    try {
+        U number = parse_number<U>(value.s, &parsed);
+        if (parsed == value.s.size()) {
+            return number;
+        }
+    }
+    catch (std::logic_error const&) {
+        // std::invalid_argument or std::out_of_range
+    }
+    throw std::invalid_argument(util::format("Invalid value '%1' for a list of type '%2'.", value.s, string_for_property_type(type)));
+}
+
+template<typename U>
+void add_ordered_comparison(Query &query, Predicate::Operator op, U value) {
+    switch (op) {
+        case Predicate::Operator::Equal: query.equal(value_column, value); break;
+        case Predicate::Operator::NotEqual: query.not_equal(value_column, value); break;
+        case Predicate::Operator::LessThan: query.less(value_column, value); break;
+        case Predicate::Operator::LessThanOrEqual: query.less_equal(value_column, value); break;
+        case Predicate::Operator::GreaterThan: query.greater(value_column, value); break;
+        case Predicate::Operator::GreaterThanOrEqual: query.greater_equal(value_column, value); break;
+        default: throw std::invalid_argument("Unsupported operator for numeric and date values.");
+    }
+}
+
+inline void add_string_comparison(Query &query, Predicate::Operator op, bool case_sensitive, StringData value) {
+    switch (op) {
+        case Predicate::Operator::Equal: query.equal(value_column, value, case_sensitive); break;
+        case Predicate::Operator::NotEqual: query.not_equal(value_column, value, case_sensitive); break;
+        case Predicate::Operator::BeginsWith: query.begins_with(value_column, value, case_sensitive); break;
+        case Predicate::Operator::EndsWith: query.ends_with(value_column, value, case_sensitive); break;
+        case Predicate::Operator::Contains: query.contains(value_column, value, case_sensitive); break;
+        case Predicate::Operator::Like: query.like(value_column, value, case_sensitive); break;
+        default: throw std::invalid_argument("Unsupported operator for string values.");
+    }
+}
+
+inline void add_binary_comparison(Query &query, Predicate::Operator op, BinaryData value) {
+    switch (op) {
+        case Predicate::Operator::Equal: query.equal(value_column, value); break;
+        case Predicate::Operator::NotEqual: query.not_equal(value_column, value); break;
+        case Predicate::Operator::BeginsWith: query.begins_with(value_column, value); break;
+        case Predicate::Operator::EndsWith: query.ends_with(value_column, value); break;
+        case Predicate::Operator::Contains: query.contains(value_column, value); break;
+        default: throw std::invalid_argument("Unsupported operator for data values.");
+    }
+}
+
+template<typename Converter>
+void add_comparison(Query &query, const Predicate::Comparison &comparison, Converter &arguments, PropertyType type) {
+    auto op = comparison.op;
+    const Expression *value = &comparison.expr[1];
+    if (!is_self(comparison.expr[0])) {
+        if (!is_self(comparison.expr[1])) {
+            throw std::invalid_argument("Predicates on lists of primitive values must compare 'self' to a value.");
+        }
+        value = &comparison.expr[0];
+        op = flipped(op);
+    }
+    if (value->type == Expression::Type::KeyPath) {
+        throw std::invalid_argument(util::format("Key path '%1' cannot be used in a predicate on a list of primitive values; use 'self'.", value->s));
+    }
+
+    bool is_argument = value->type == Expression::Type::Argument;
+    if (value->type == Expression::Type::Null || (is_argument && arguments.is_argument_null(argument_index(*value)))) {
+        if (op == Predicate::Operator::Equal) {
+            query.equal(value_column, null());
+        }
+        else if (op == Predicate::Operator::NotEqual) {
+            query.not_equal(value_column, null());
+        }
+        else {
+            throw std::invalid_argument("Only '==' and '!=' can be used to compare values to null.");
+        }
+        return;
+    }
+
+    auto check_literal = [&](bool valid) {
+        if (!is_argument && !valid) {
+            throw std::invalid_argument(util::format("Invalid value '%1' for a list of type '%2'.", value->s, string_for_property_type(type)));
+        }
+    };
+
+    switch (type) {
+        case PropertyType::Bool: {
+            bool is_true = value->type == Expression::Type::True;
+            check_literal(is_true || value->type == Expression::Type::False);
+            bool b = is_argument ? arguments.bool_for_argument(argument_index(*value)) : is_true;
+            if (op == Predicate::Operator::Equal) {
+                query.equal(value_column, b);
+            }
+            else if (op == Predicate::Operator::NotEqual) {
+                query.Not();
+                query.equal(value_column, b);
+            }
+            else {
+                unsupported_operator(type);
+            }
+            break;
+        }
+        case PropertyType::Int:
+            check_literal(value->type == Expression::Type::Number);
+            add_ordered_comparison(query, op, int64_t(is_argument ? arguments.long_for_argument(argument_index(*value)) : parse_literal<int64_t>(*value, type)));
+            break;
+        case PropertyType::Float:
+            check_literal(value->type == Expression::Type::Number);
+            add_ordered_comparison(query, op, is_argument ? arguments.float_for_argument(argument_index(*value)) : parse_literal<float>(*value, type));
+            break;
+        case PropertyType::Double:
+            check_literal(value->type == Expression::Type::Number);
+            add_ordered_comparison(query, op, is_argument ? arguments.double_for_argument(argument_index(*value)) : parse_literal<double>(*value, type));
+            break;
+        case PropertyType::Date:
+            if (!is_argument) {
+                throw std::invalid_argument("Dates in predicates on lists of primitive values must be passed as arguments.");
+            }
+            add_ordered_comparison(query, op, arguments.timestamp_for_argument(argument_index(*value)));
+            break;
+        case PropertyType::String: {
+            check_literal(value->type == Expression::Type::String);
+            bool case_sensitive = comparison.option != Predicate::OperatorOption::CaseInsensitive;
+            if (is_argument) {
+                auto string = arguments.string_for_argument(argument_index(*value));
+                add_string_comparison(query, op, case_sensitive, StringData(string));
+            }
+            else {
+                add_string_comparison(query, op, case_sensitive, value->s);
+            }
+            break;
+        }
+        case PropertyType::Data: {
+            check_literal(value->type == Expression::Type::String);
+            if (is_argument) {
+                auto data = arguments.binary_for_argument(argument_index(*value));
+                add_binary_comparison(query, op, binary_data(data));
+            }
+            else {
+                add_binary_comparison(query, op, binary_data(value->s));
+            }
+            break;
+        }
+        default:
+            unsupported_operator(type);
+    }
+}
+
+template<typename Converter>
+void update_query_with_predicate(Query &query, const Predicate &predicate, Converter &arguments, PropertyType type) {
+    if (predicate.negate) {
+        query.Not();
+    }
+
+    switch (predicate.type) {
+        case Predicate::Type::And:
+            query.group();
+            for (auto &sub_predicate : predicate.cpnd.sub_predicates) {
+                update_query_with_predicate(query, sub_predicate, arguments, type);
+            }
+            if (predicate.cpnd.sub_predicates.empty()) {
+                query.and_query(std::unique_ptr<realm::Expression>(new TrueExpression));
+            }
+            query.end_group();
+            break;
+
+        case Predicate::Type::Or:
+            query.group();
+            for (auto &sub_predicate : predicate.cpnd.sub_predicates) {
+                query.Or();
+                update_query_with_predicate(query, sub_predicate, arguments, type);
+            }
+            if (predicate.cpnd.sub_predicates.empty()) {
+                query.and_query(std::unique_ptr<realm::Expression>(new FalseExpression));
+            }
+            query.end_group();
+            break;
+
+        case Predicate::Type::Comparison:
+            add_comparison(query, predicate.cmpr, arguments, type);
+            break;
+
+        case Predicate::Type::True:
+            query.and_query(std::unique_ptr<realm::Expression>(new TrueExpression));
+            break;
+
+        case Predicate::Type::False:
+            query.and_query(std::unique_ptr<realm::Expression>(new FalseExpression));
+            break;
+    }
+}
+
+} // namespace _impl
+
+// Adds `predicate` to `query`, which must be over a table of primitive values of type `type`.
+template<typename Converter>
+void apply_predicate(Query &query, const parser::Predicate &predicate, Converter &arguments, PropertyType type) {
+    _impl::update_query_with_predicate(query, predicate, arguments, type & ~PropertyType::Flags);
+
+    // Test the constructed query in core.
+    std::string validate_message = query.validate();
+    if (validate_message != "") {
+        throw std::invalid_argument(validate_message);
+    }
+}
+
+} // namespace primitive_query_builder
+} // namespace js
+} // namespace realm
@@ -581,7 +581,7 @@ json RPCServer::serialize_json_value(JSValueRef js_value) {
         auto data = jsc::Value::to_binary(m_context, js_object);
         return {
             {"type", RealmObjectTypesData},
-            {"value", base64_encode((unsigned char *)data.data(), data.size())},
+            {"value", js::base64::encode(data.data(), data.size())},
         };
     }
     else if (jsc::Value::is_date(m_context, js_object)) {
@@ -660,7 +660,7 @@ JSValueRef RPCServer::deserialize_json_value(const json dict) {
         }
         else if (type_string == RealmObjectTypesData) {
             std::string bytes;
-            if (!base64_decode(value.get<std::string>(), &bytes)) {
+            if (!js::base64::decode(value.get<std::string>(), bytes)) {
                 throw std::runtime_error("Failed to decode base64 encoded data");
             }
             return jsc::Value::from_binary(m_context, realm::BinaryData(bytes.data(), bytes.size()));
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "concurrent_deque.hpp"
+
+namespace realm {
+
+// A fixed number of threads which run the tasks submitted to them in the order they were submitted.
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t thread_count) {
+        for (size_t i = 0; i < thread_count; i++) {
+            m_threads.emplace_back([this] {
+                // An empty task tells the thread to exit.
+                while (auto task = m_tasks.pop_back()) {
+                    task();
+                }
+            });
+        }
+    }
+
+    // Waits for the tasks which have already been submitted to finish.
+    ~ThreadPool() {
+        for (size_t i = 0; i < m_threads.size(); i++) {
+            m_tasks.push_front(std::function<void()>());
+        }
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    // Runs `function` on one of the threads. The future returned has its result, or the exception it threw.
+    template<typename Function>
+    auto submit(Function &&function) -> std::future<decltype(function())> {
+        using Result = decltype(function());
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+        auto future = task->get_future();
+        m_tasks.push_front([task] { (*task)(); });
+        return future;
+    }
+
+    size_t size() const {
+        return m_threads.size();
+    }
+
+private:
+    ConcurrentDeque<std::function<void()>> m_tasks;
+    std::vector<std::thread> m_threads;
+};
+
+} // realm
@@ -0,0 +1,80 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+// Throughput benchmark for the base64 codec in src/base64.hpp. The codec is header-only, so this
+// builds without Realm:
+//
+//     c++ -std=c++14 -O2 -I src tests/benchmarks/base64.cpp -o base64-benchmark && ./base64-benchmark
+
+#include "base64.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace realm::js;
+
+namespace {
+
+template<typename Fn>
+double megabytes_per_second(size_t bytes_per_run, Fn&& fn) {
+    using clock = std::chrono::steady_clock;
+    size_t runs = 0;
+    auto start = clock::now();
+    std::chrono::duration<double> elapsed;
+    do {
+        fn();
+        ++runs;
+        elapsed = clock::now() - start;
+    } while (elapsed.count() < 0.5);
+    return bytes_per_run * runs / elapsed.count() / (1024 * 1024);
+}
+
+} // anonymous namespace
+
+int main() {
+    std::mt19937 rng(0);
+    for (size_t size : {16, 128, 1024, 64 * 1024, 1024 * 1024}) {
+        std::vector<char> data(size);
+        for (auto& byte : data) {
+            byte = static_cast<char>(rng());
+        }
+
+        std::string encoded(base64::encoded_size(size), '\0');
+        std::vector<char> decoded(base64::decoded_size(encoded.size()));
+        base64::encode(data.data(), size, &encoded[0]);
+        if (base64::decode(encoded.data(), encoded.size(), decoded.data()) != size ||
+            !std::equal(data.begin(), data.end(), decoded.begin())) {
+            std::fprintf(stderr, "round trip failed for %zu bytes\n", size);
+            return EXIT_FAILURE;
+        }
+
+        double encode = megabytes_per_second(size, [&] {
+            base64::encode(data.data(), size, &encoded[0]);
+        });
+        double decode = megabytes_per_second(size, [&] {
+            base64::decode(encoded.data(), encoded.size(), decoded.data());
+        });
+        std::printf("%8zu bytes: encode %8.1f MB/s, decode %8.1f MB/s\n", size, encode, decode);
+    }
+    return EXIT_SUCCESS;
+}
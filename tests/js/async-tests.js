@@ -356,5 +356,203 @@ module.exports = {
             ]
         );
     },
-};
 
+    testWorkerThreads() {
+        let worker_threads;
+        try {
+            worker_threads = require('worker_threads');
+        }
+        catch (e) {
+            // worker_threads isn't available before Node 10.5, or without --experimental-worker before 11.7.
+            return Promise.resolve();
+        }
+
+        const config = { schema: [schemas.TestObject] };
+        const realm = new Realm(config);
+        realm.write(() => {
+            for (let i = 0; i < 100; i++) {
+                realm.create('TestObject', { doubleCol: i });
+            }
+        });
+
+        // Each worker loads the module into its own isolate and reads the Realm in parallel with the others.
+        // Notifications are only delivered on the main thread, so workers can't add listeners.
+        const script = `
+            const { parentPort, workerData } = require('worker_threads');
+            const Realm = require(workerData.modulePath);
+            const realm = new Realm(workerData.config);
+            const objects = realm.objects('TestObject').filtered('doubleCol >= $0', workerData.min);
+            const listenerErrors = [
+                () => realm.addListener('change', () => {}),
+                () => objects.addListener(() => {}),
+            ].map(addListener => {
+                try {
+                    addListener();
+                    return null;
+                }
+                catch (e) {
+                    return e.message;
+                }
+            });
+            parentPort.postMessage({ count: objects.length, isResults: objects instanceof Realm.Results, listenerErrors });
+            realm.close();
+        `;
+        const run = (min) => new Promise((resolve, reject) => {
+            const worker = new worker_threads.Worker(script, {
+                eval: true,
+                workerData: { modulePath: REALM_MODULE_PATH, config: { path: realm.path, schema: config.schema }, min: min }, // eslint-disable-line no-undef
+            });
+            worker.on('message', resolve);
+            worker.on('error', reject);
+        });
+
+        return Promise.all([run(0), run(50), run(90)]).then(results => {
+            TestCase.assertArraysEqual(results.map(result => result.count), [100, 50, 10]);
+            results.forEach(result => {
+                TestCase.assertTrue(result.isResults);
+                TestCase.assertArraysEqual(result.listenerErrors, [
+                    'Change listeners are not supported in worker threads.',
+                    'Change listeners are not supported in worker threads.',
+                ]);
+            });
+
+            // The classes of the main thread keep working after the workers have exited.
+            TestCase.assertTrue(realm.objects('TestObject') instanceof Realm.Results);
+            realm.close();
+        });
+    },
+
+    testWorkerThreadsWhileMainThreadCommits() {
+        let worker_threads;
+        try {
+            worker_threads = require('worker_threads');
+        }
+        catch (e) {
+            return Promise.resolve();
+        }
+
+        const config = { schema: [schemas.TestObject] };
+        const realm = new Realm(config);
+        realm.write(() => realm.create('TestObject', { doubleCol: 1 }));
+
+        // The worker keeps its Realm open while the main thread commits, which mustn't make the main
+        // thread deliver notifications to it. The worker's Realm stays at the version it was reading.
+        const script = `
+            const { parentPort, workerData } = require('worker_threads');
+            const Realm = require(workerData.modulePath);
+            const realm = new Realm(workerData.config);
+            const objects = realm.objects('TestObject');
+            parentPort.postMessage({ count: objects.length });
+            parentPort.once('message', () => {
+                const countBeforeWrite = objects.length;
+                realm.write(() => realm.create('TestObject', { doubleCol: 3 }));
+                parentPort.postMessage({ count: countBeforeWrite, countAfterWrite: objects.length });
+                realm.close();
+            });
+        `;
+
+        return new Promise((resolve, reject) => {
+            const worker = new worker_threads.Worker(script, {
+                eval: true,
+                workerData: { modulePath: REALM_MODULE_PATH, config: { path: realm.path, schema: config.schema } }, // eslint-disable-line no-undef
+            });
+            const messages = [];
+            worker.on('error', reject);
+            worker.on('exit', () => resolve(messages));
+            worker.on('message', message => {
+                messages.push(message);
+                if (messages.length === 1) {
+                    realm.write(() => realm.create('TestObject', { doubleCol: 2 }));
+                    // Let the notifier signal the commit before the worker reads again.
+                    setTimeout(() => worker.postMessage('continue'), 100);
+                }
+            });
+        }).then(messages => {
+            TestCase.assertArraysEqual(messages.map(message => message.count), [1, 1]);
+            TestCase.assertEqual(messages[1].countAfterWrite, 3);
+            realm.close();
+        });
+    },
+
+    testThreadSafeReferenceInWorkerThread() {
+        let worker_threads;
+        try {
+            worker_threads = require('worker_threads');
+        }
+        catch (e) {
+            return Promise.resolve();
+        }
+
+        const config = { schema: [schemas.TestObject] };
+        const realm = new Realm(config);
+        realm.write(() => {
+            for (let i = 0; i < 10; i++) {
+                realm.create('TestObject', { doubleCol: i });
+            }
+        });
+        const reference = realm.obtainThreadSafeReference(realm.objects('TestObject').filtered('doubleCol > 6'));
+
+        // The worker resolves the Results by id against its own Realm instead of running the query.
+        const script = `
+            const { parentPort, workerData } = require('worker_threads');
+            const Realm = require(workerData.modulePath);
+            const realm = new Realm(workerData.config);
+            const results = realm.resolveThreadSafeReference(workerData.id);
+            parentPort.postMessage(results.map(object => object.doubleCol));
+            realm.close();
+        `;
+        return new Promise((resolve, reject) => {
+            const worker = new worker_threads.Worker(script, {
+                eval: true,
+                workerData: { modulePath: REALM_MODULE_PATH, config: { path: realm.path, schema: config.schema }, id: reference.id }, // eslint-disable-line no-undef
+            });
+            worker.on('message', resolve);
+            worker.on('error', reject);
+        }).then(values => {
+            TestCase.assertArraysEqual(values, [7, 8, 9]);
+            TestCase.assertTrue(reference.isResolved);
+            realm.close();
+        });
+    },
+
+    testInProcessWorker() {
+        if (!Realm.Worker) {
+            // Realm.Worker is only available with sync.
+            return Promise.resolve();
+        }
+
+        const modulePath = __dirname + '/notification-worker-module.js';
+        const state = require(modulePath).state;
+        // events are processed one at a time unless a limit is given
+        TestCase.assertEqual(new Realm.Worker(modulePath, { inProcess: true }).maxWorkers, 1);
+
+        const worker = new Realm.Worker(modulePath, { inProcess: true, maxWorkers: 2, maxQueuedChanges: 3 });
+        let drained = 0;
+        worker._addDrainListener(() => drained++);
+
+        let released = 0;
+        const changes = [];
+        for (let i = 0; i < 6; i++) {
+            changes.push({ path: '/a', isEmpty: i === 5, release: () => released++ });
+        }
+
+        worker.onavailable('/a');
+        changes.forEach(change => worker.onchange(change));
+        TestCase.assertTrue(worker.isSaturated);
+
+        return worker.stop().then(() => {
+            TestCase.assertArraysEqual(state.available, ['/a']);
+            // The module is given the change objects themselves, and not empty ones.
+            TestCase.assertEqual(state.changes.length, 5);
+            state.changes.forEach((change, i) => TestCase.assertTrue(change === changes[i]));
+            TestCase.assertEqual(state.maxRunning, 2);
+            TestCase.assertEqual(released, 6);
+            TestCase.assertFalse(worker.isSaturated);
+            TestCase.assertTrue(drained > 0);
+
+            // Changes arriving after the worker has stopped are released right away.
+            worker.onchange({ path: '/a', isEmpty: false, release: () => released++ });
+            TestCase.assertEqual(released, 7);
+        });
+    },
+};
@@ -57,6 +57,36 @@ module.exports = {
         });
     },
 
+    testLinkingObjectsCount: function() {
+        var realm = new Realm({schema: [schemas.PersonObject]});
+
+        var olivier;
+        realm.write(function() {
+            olivier = realm.create('PersonObject', {name: 'Olivier', age: 0});
+        });
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'), 0);
+
+        realm.write(function() {
+            realm.create('PersonObject', {name: 'Christine', age: 25, children: [olivier]});
+            realm.create('PersonObject', {name: 'JP', age: 28, children: [olivier]});
+        });
+
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'), 2);
+        TestCase.assertEqual(olivier.linkingObjectsCount('PersonObject', 'children'),
+                             olivier.linkingObjects('PersonObject', 'children').length);
+
+        TestCase.assertThrowsContaining(() => olivier.linkingObjectsCount('NoSuchSchema', 'noSuchProperty'),
+            "Could not find schema for type 'NoSuchSchema'");
+        TestCase.assertThrowsContaining(() => olivier.linkingObjectsCount('PersonObject', 'name'),
+            "'PersonObject.name' is not a relationship to 'PersonObject'");
+        TestCase.assertThrows(() => olivier.linkingObjectsCount('PersonObject'));
+
+        realm.write(function() {
+            realm.delete(olivier);
+        });
+        TestCase.assertThrows(() => olivier.linkingObjectsCount('PersonObject', 'children'));
+    },
+
     testFilteredLinkingObjects: function() {
         var realm = new Realm({schema: [schemas.PersonObject]});
 
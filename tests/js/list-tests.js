@@ -597,6 +597,139 @@ module.exports = {
         }, "Cannot modify managed objects outside of a write transaction");
     },
 
+    testListAssign: function() {
+        const realm = new Realm({schema: [schemas.IntPrimary, {
+            name: 'ListOwner',
+            properties: {
+                ints: 'int[]',
+                strings: 'string?[]',
+                items: 'IntPrimaryObject[]',
+            }
+        }]});
+
+        let owner;
+        realm.write(() => {
+            owner = realm.create('ListOwner', {ints: [1, 2, 3], strings: ['a', null], items: [{primaryCol: 1, valueCol: 'one'}]});
+
+            TestCase.assertEqual(owner.ints.assign([4, 5]), 2);
+            TestCase.assertArraysEqual(owner.ints, [4, 5]);
+
+            TestCase.assertEqual(owner.ints.assign([1, 4, 6, 5], {diff: true}), 4);
+            TestCase.assertArraysEqual(owner.ints, [1, 4, 6, 5]);
+            owner.ints.assign([], {diff: true});
+            TestCase.assertEqual(owner.ints.length, 0);
+
+            owner.strings.assign([null, 'b', 'a', 'a'], {diff: true});
+            TestCase.assertArraysEqual(owner.strings, [null, 'b', 'a', 'a']);
+
+            // plain objects with a primary key update the existing objects
+            const one = realm.objectForPrimaryKey('IntPrimaryObject', 1);
+            owner.items.assign([{primaryCol: 2, valueCol: 'two'}, {primaryCol: 1, valueCol: 'uno'}], {diff: true});
+            TestCase.assertEqual(owner.items.length, 2);
+            TestCase.assertEqual(owner.items[0].primaryCol, 2);
+            TestCase.assertTrue(owner.items[1]._isSameObject(one));
+            TestCase.assertEqual(one.valueCol, 'uno');
+            TestCase.assertEqual(realm.objects('IntPrimaryObject').length, 2);
+
+            TestCase.assertThrowsContaining(() => owner.ints.assign(['cat']), "Property must be of type 'int'");
+            TestCase.assertThrows(() => owner.ints.assign(5));
+            TestCase.assertThrows(() => owner.ints.assign([], {diff: 'yes'}));
+        });
+
+        TestCase.assertThrowsContaining(() => owner.ints.assign([1]),
+                                        "Cannot modify managed objects outside of a write transaction");
+    },
+
+    testListAssignDiffNotifications: function() {
+        const realm = new Realm({schema: [{name: 'ListOwner', properties: {ints: 'int[]'}}]});
+        let owner;
+        realm.write(() => {
+            owner = realm.create('ListOwner', {ints: [1, 2, 3, 4, 5]});
+        });
+
+        let resolve = () => {};
+        let first = true;
+        owner.ints.addListener((ints, changes) => {
+            if (first) {
+                first = false;
+                realm.write(() => {
+                    ints.assign([1, 3, 4, 6, 5], {diff: true});
+                });
+                return;
+            }
+            TestCase.assertArraysEqual(changes.deletions, [1]);
+            TestCase.assertArraysEqual(changes.insertions, [3]);
+            TestCase.assertArraysEqual(changes.modifications, []);
+            resolve();
+        });
+
+        return new Promise((r) => resolve = r);
+    },
+
+    testListPushAll: function() {
+        const realm = new Realm({schema: [{
+            name: 'Samples',
+            properties: {
+                ints: 'int[]',
+                floats: 'float[]',
+                doubles: 'double?[]',
+                strings: 'string[]',
+            }
+        }]});
+
+        let samples;
+        realm.write(() => {
+            samples = realm.create('Samples', {ints: [1]});
+
+            TestCase.assertEqual(samples.ints.pushAll(new Int32Array([2, -3])), 3);
+            TestCase.assertEqual(samples.ints.pushAll(new Uint8Array([255])), 4);
+            // views of part of a buffer only add their own elements
+            TestCase.assertEqual(samples.ints.pushAll(new Int16Array(new Int16Array([7, 8, 9]).buffer, 2, 1)), 5);
+            TestCase.assertEqual(samples.ints.pushAll([10, 11]), 7);
+            TestCase.assertArraysEqual(samples.ints, [1, 2, -3, 255, 8, 10, 11]);
+
+            samples.floats.pushAll(new Float32Array([0.5, 1.5]));
+            samples.doubles.pushAll(new Float64Array([0.25, -1e10]));
+            samples.doubles.pushAll([null]);
+            // subclasses are recognized by their element type rather than their name
+            class Samples extends Float64Array {}
+            samples.doubles.pushAll(new Samples([4.5]));
+            samples.strings.pushAll(['a', 'b']);
+            TestCase.assertArraysEqual(samples.floats, [0.5, 1.5]);
+            TestCase.assertArraysEqual(samples.doubles, [0.25, -1e10, null, 4.5]);
+            TestCase.assertArraysEqual(samples.strings, ['a', 'b']);
+
+            TestCase.assertThrowsContaining(() => samples.ints.pushAll(new Float64Array([1.5])),
+                                            "Float64Array elements cannot be added to a list of type 'int'");
+            TestCase.assertThrowsContaining(() => samples.strings.pushAll(new Int32Array([1])),
+                                            "Int32Array elements cannot be added to a list of type 'string'");
+            TestCase.assertThrowsContaining(() => samples.ints.pushAll(['cat']), "Property must be of type 'int'");
+            TestCase.assertThrows(() => samples.ints.pushAll(new DataView(new ArrayBuffer(4))));
+            TestCase.assertThrows(() => samples.ints.pushAll(5));
+        });
+        TestCase.assertEqual(samples.ints.length, 7);
+
+        const ints = samples.ints.toTypedArray();
+        TestCase.assertTrue(ints instanceof Float64Array);
+        TestCase.assertArraysEqual(Array.from(ints), [1, 2, -3, 255, 8, 10, 11]);
+        TestCase.assertArraysEqual(Array.from(samples.ints.toTypedArray('Int8Array')), [1, 2, -3, -1, 8, 10, 11]);
+        TestCase.assertArraysEqual(Array.from(samples.ints.toTypedArray('Uint8ClampedArray')), [1, 2, 0, 255, 8, 10, 11]);
+
+        TestCase.assertTrue(samples.floats.toTypedArray() instanceof Float32Array);
+        const doubles = samples.doubles.toTypedArray();
+        TestCase.assertEqual(doubles.length, 4);
+        TestCase.assertEqual(doubles[1], -1e10);
+        TestCase.assertTrue(isNaN(doubles[2]));
+
+        TestCase.assertThrowsContaining(() => samples.doubles.toTypedArray('Int32Array'),
+                                        "Lists of type 'double' cannot be converted to Int32Array");
+        TestCase.assertThrowsContaining(() => samples.ints.toTypedArray('Array'), "'Array' is not a supported TypedArray type");
+        TestCase.assertThrowsContaining(() => samples.strings.toTypedArray(),
+                                        "Lists of type 'string' cannot be converted to a TypedArray");
+        TestCase.assertThrowsContaining(() => samples.ints.pushAll([1]),
+                                        "Cannot modify managed objects outside of a write transaction");
+    },
+
     testListDeletions: function() {
         const realm = new Realm({schema: [schemas.LinkTypes, schemas.TestObject]});
         let object;
@@ -826,6 +959,57 @@ module.exports = {
         TestCase.assertArraysEqual(prim.optDate.sorted(), [null, DATE1, DATE2, DATE3]);
     },
 
+    testListFilteredPrimitives: function() {
+        const realm = new Realm({schema: [schemas.PrimitiveArrays]});
+        let prim;
+        realm.write(() => {
+            prim = realm.create('PrimitiveArrays', {
+                bool: [true, false, true],
+                int: [3, 1, 2, 3],
+                double: [3.5, 1.5, 2.5],
+                string: ['cat', 'Cow', 'dog'],
+                data: [DATA1, DATA2],
+                date: [DATE3, DATE1, DATE2],
+                optInt: [3, null, 1],
+                optString: ['a', null],
+            });
+        });
+
+        TestCase.assertArraysEqual(prim.int.filtered('self > 1'), [3, 2, 3]);
+        TestCase.assertArraysEqual(prim.int.filtered('2 <= self'), [3, 2, 3]);
+        TestCase.assertArraysEqual(prim.int.filtered('self == $0 || self == $1', 1, 2), [1, 2]);
+        TestCase.assertArraysEqual(prim.int.filtered('NOT (self == 3)'), [1, 2]);
+        TestCase.assertArraysEqual(prim.int.filtered('self > 1').sorted(), [2, 3, 3]);
+        TestCase.assertArraysEqual(prim.int.filtered('self > 1').distinct(), [3, 2]);
+        TestCase.assertArraysEqual(prim.int.distinct(), [3, 1, 2]);
+        TestCase.assertArraysEqual(prim.int.sorted().distinct('self'), [1, 2, 3]);
+        TestCase.assertArraysEqual(prim.bool.filtered('self == false'), [false]);
+        TestCase.assertArraysEqual(prim.bool.filtered('self != $0', true), [false]);
+        TestCase.assertArraysEqual(prim.double.filtered('self < 3'), [1.5, 2.5]);
+        TestCase.assertArraysEqual(prim.string.filtered('self BEGINSWITH[c] "c"'), ['cat', 'Cow']);
+        TestCase.assertArraysEqual(prim.string.filtered('self LIKE "?o?"'), ['Cow', 'dog']);
+        TestCase.assertArraysEqual(prim.data.filtered('self == $0', DATA2), [DATA2]);
+        TestCase.assertArraysEqual(prim.date.filtered('self > $0', DATE1), [DATE3, DATE2]);
+        TestCase.assertArraysEqual(prim.optInt.filtered('self == null'), [null]);
+        TestCase.assertArraysEqual(prim.optInt.filtered('self != $0', null), [3, 1]);
+        TestCase.assertArraysEqual(prim.optString.filtered('self != null'), ['a']);
+
+        // the results are live
+        const ones = prim.int.filtered('self == 1');
+        realm.write(() => prim.int.push(1));
+        TestCase.assertEqual(ones.length, 2);
+
+        TestCase.assertThrowsContaining(() => prim.int.filtered('value > 1'),
+                                        "Predicates on lists of primitive values must compare 'self' to a value.");
+        TestCase.assertThrowsContaining(() => prim.int.filtered('self > "a"'), "Invalid value 'a' for a list of type 'int'");
+        TestCase.assertThrowsContaining(() => prim.int.filtered('self > 1.5'), "Invalid value '1.5' for a list of type 'int'");
+        TestCase.assertThrowsContaining(() => prim.int.filtered('self > 99999999999999999999'),
+                                        "Invalid value '99999999999999999999' for a list of type 'int'");
+        TestCase.assertThrowsContaining(() => prim.bool.filtered('self > true'), "Unsupported operator for lists of type 'bool'");
+        TestCase.assertThrowsContaining(() => prim.int.distinct('value'),
+                                        "Cannot distinct on key path 'value': arrays of 'int' can only be distinct on 'self'");
+    },
+
     testArrayMethods: function() {
         const realm = new Realm({schema: [schemas.PersonObject, schemas.PersonList, schemas.PrimitiveArrays]});
         let object, prim;
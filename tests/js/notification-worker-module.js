@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2018 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+/* eslint-env es6, node */
+
+'use strict';
+
+// A module for an in-process Realm.Worker which records the events it is given.
+const state = {available: [], changes: [], running: 0, maxRunning: 0};
+
+function onavailable(path) {
+    state.available.push(path);
+}
+
+function onchange(change) {
+    state.changes.push(change);
+    state.maxRunning = Math.max(state.maxRunning, ++state.running);
+    return new Promise(resolve => setTimeout(resolve, 5)).then(() => {
+        state.running--;
+    });
+}
+
+module.exports = {onavailable, onchange, state};
@@ -297,14 +297,27 @@ module.exports = {
         });
         TestCase.assertArraysEqual(new Uint8Array(object.dataCol), RANDOM_DATA);
 
-        if (Realm.Sync) {
-            // The base64 decoder comes from realm-sync
-            // Should be able to also set a data property to base64-encoded string.
+        // Should be able to also set a data property to base64-encoded string.
+        realm.write(function() {
+            object.dataCol = require('buffer/').Buffer.from(RANDOM_DATA).toString('base64');
+        });
+        TestCase.assertArraysEqual(new Uint8Array(object.dataCol), RANDOM_DATA);
+
+        // Long base64 strings go through the vectorized decoder.
+        var longData = new Uint8Array(1000);
+        for (var i = 0; i < longData.length; i++) {
+            longData[i] = (i * 37) & 0xff;
+        }
+        realm.write(function() {
+            object.dataCol = require('buffer/').Buffer.from(longData).toString('base64');
+        });
+        TestCase.assertArraysEqual(new Uint8Array(object.dataCol), longData);
+
+        TestCase.assertThrows(function() {
             realm.write(function() {
-                object.dataCol = require('buffer/').Buffer.from(RANDOM_DATA).toString('base64');
+                object.dataCol = 'not base64!';
             });
-            TestCase.assertArraysEqual(new Uint8Array(object.dataCol), RANDOM_DATA);
-        }
+        }, 'Setting a data property to invalid base64 should throw');
 
         // Should be to set a data property to a DataView.
         realm.write(function() {
@@ -365,6 +378,31 @@ module.exports = {
         });
     },
 
+    testStringProperties: function() {
+        const realm = new Realm({schema: [{name: 'StringObject', properties: {string: 'string'}}]});
+        const largeAscii = new Array(100 * 1024 + 1).join('a');
+        const strings = ['', 'ascii', 'caf\u00e9', '\u65e5\u672c\u8a9e', '\ud83d\ude00 emoji', 'nul\u0000inside',
+                         largeAscii, largeAscii + '\u00e9'];
+
+        realm.write(function() {
+            strings.forEach(function(string) {
+                realm.create('StringObject', {string: string});
+            });
+        });
+
+        const objects = realm.objects('StringObject');
+        TestCase.assertEqual(objects.length, strings.length);
+        strings.forEach(function(string, index) {
+            TestCase.assertEqual(objects[index].string, string);
+        });
+
+        realm.write(function() {
+            TestCase.assertThrows(function() {
+                objects[0].string = 1;
+            });
+        });
+    },
+
     testObjectConstructor: function() {
         const realm = new Realm({schema: [schemas.TestObject]});
 
@@ -455,6 +493,133 @@ module.exports = {
         TestCase.assertEqual(realm.objects('Date')[4].currentDate.toString(), stringifiedDate.toString());
     },
 
+    testIntegerProperties: function() {
+        const schema = [{name: 'IntObject', primaryKey: 'id', properties: {id: 'int', intCol: 'int?', intList: 'int[]'}}];
+        let realm = new Realm({schema: schema});
+        realm.write(function() {
+            realm.create('IntObject', {id: 1, intCol: -2147483648, intList: [2147483647, 2147483648, -9007199254740991]});
+            TestCase.assertThrows(() => realm.create('IntObject', {id: 2, intCol: 1e20}));
+            TestCase.assertThrows(() => realm.create('IntObject', {id: 3, intCol: 'one'}));
+        });
+
+        let object = realm.objectForPrimaryKey('IntObject', 1);
+        TestCase.assertEqual(object.intCol, -2147483648);
+        TestCase.assertArraysEqual(object.intList, [2147483647, 2147483648, -9007199254740991]);
+        realm.close();
+
+        if (typeof BigInt !== 'function') {
+            TestCase.assertThrows(() => new Realm({schema: schema, integerRepresentation: 'bigint'}));
+            return;
+        }
+
+        const snowflake = BigInt('1152921504606846977');
+        realm = new Realm({schema: schema, integerRepresentation: 'bigint'});
+        realm.write(function() {
+            realm.create('IntObject', {id: snowflake, intCol: BigInt(-5), intList: [BigInt('-9223372036854775808'), 7]});
+            TestCase.assertThrows(() => realm.create('IntObject', {id: BigInt('9223372036854775808')}));
+        });
+
+        object = realm.objectForPrimaryKey('IntObject', snowflake);
+        TestCase.assertEqual(object.id, snowflake);
+        TestCase.assertEqual(object.intCol, BigInt(-5));
+        TestCase.assertEqual(object.intList[0], BigInt('-9223372036854775808'));
+        TestCase.assertEqual(object.intList[1], BigInt(7));
+        TestCase.assertEqual(realm.objects('IntObject').filtered('id == $0', snowflake).length, 1);
+        TestCase.assertEqual(realm.objectForPrimaryKey('IntObject', BigInt(1)).intCol, BigInt(-2147483648));
+        TestCase.assertEqual(realm.objects('IntObject').max('id'), snowflake);
+        TestCase.assertEqual(realm.objects('IntObject').sum('intCol'), BigInt(-2147483653));
+        TestCase.assertEqual(object.intList.min(), BigInt('-9223372036854775808'));
+        TestCase.assertEqual(realm.objects('IntObject').aggregate({sum: 'intCol', min: 'id'}).sum.intCol, BigInt(-2147483653));
+        TestCase.assertEqual(realm.objects('IntObject').aggregate({sum: 'intCol', min: 'id'}).min.id, BigInt(1));
+        TestCase.assertThrowsContaining(() => new Realm({schema: schema}),
+                                        'already open with a different integerRepresentation');
+        TestCase.assertEqual(object.intCol, BigInt(-5));
+        realm.close();
+
+        TestCase.assertThrows(() => new Realm({schema: schema, integerRepresentation: 'string'}));
+    },
+
+    testDateRepresentation: function() {
+        const schema = [{name: 'DateObject', properties: {dateCol: 'date', optDateCol: 'date?', dateList: 'date[]'}}];
+        let realm = new Realm({schema: schema, dateRepresentation: 'milliseconds'});
+        realm.write(function() {
+            realm.create('DateObject', {dateCol: new Date(1000), optDateCol: 2000.5, dateList: [3000, new Date(-4000)]});
+            realm.create('DateObject', {dateCol: [5, 6000000], optDateCol: null, dateList: []});
+        });
+
+        let objects = realm.objects('DateObject');
+        TestCase.assertEqual(objects[0].dateCol, 1000);
+        TestCase.assertEqual(objects[0].optDateCol, 2000.5);
+        TestCase.assertArraysEqual(objects[0].dateList, [3000, -4000]);
+        TestCase.assertEqual(objects[1].dateCol, 5006);
+        TestCase.assertEqual(objects[1].optDateCol, null);
+        TestCase.assertEqual(objects.filtered('dateCol > $0', 2000).length, 1);
+        TestCase.assertEqual(objects.max('dateCol'), 5006);
+        TestCase.assertEqual(objects.aggregate({min: 'dateCol'}).min.dateCol, 1000);
+        realm.close();
+
+        realm = new Realm({schema: schema, dateRepresentation: 'secondsNanoseconds'});
+        objects = realm.objects('DateObject');
+        TestCase.assertArraysEqual(objects[0].optDateCol, [2, 500000]);
+        TestCase.assertArraysEqual(objects[1].dateCol, [5, 6000000]);
+        realm.write(function() {
+            TestCase.assertThrows(() => objects[0].dateCol = [1, 2, 3]);
+            TestCase.assertThrows(() => objects[0].dateCol = [1, -2]);
+            TestCase.assertThrows(() => objects[0].dateCol = [NaN, 0]);
+            TestCase.assertThrows(() => objects[0].dateCol = [0, NaN]);
+            TestCase.assertThrows(() => objects[0].dateCol = [1.5, 0]);
+            TestCase.assertThrows(() => objects[0].dateCol = [1, 0.5]);
+            TestCase.assertThrows(() => objects[0].dateCol = [Infinity, 0]);
+            TestCase.assertThrows(() => objects[0].dateCol = [1e19, 0]);
+            TestCase.assertThrowsContaining(() => objects[0].dateCol = NaN, 'Invalid date');
+            TestCase.assertThrowsContaining(() => objects[0].dateCol = Infinity, 'Invalid date');
+            TestCase.assertThrowsContaining(() => objects[0].dateCol = -Infinity, 'Invalid date');
+            TestCase.assertThrowsContaining(() => objects[0].dateCol = 1e19, 'Invalid date');
+        });
+        TestCase.assertArraysEqual(objects[0].dateCol, [1, 0]);
+        realm.close();
+
+        realm = new Realm({schema: schema});
+        TestCase.assertEqual(realm.objects('DateObject')[0].dateCol.getTime(), 1000);
+        realm.close();
+
+        // The instances of an open Realm share its representation.
+        realm = new Realm({schema: schema, dateRepresentation: 'milliseconds'});
+        TestCase.assertThrowsContaining(() => new Realm({schema: schema}),
+                                        'already open with a different dateRepresentation');
+        TestCase.assertThrowsContaining(() => new Realm({schema: schema, dateRepresentation: 'secondsNanoseconds'}),
+                                        'already open with a different dateRepresentation');
+        TestCase.assertEqual(new Realm({schema: schema, dateRepresentation: 'milliseconds'}).objects('DateObject')[0].dateCol, 1000);
+        TestCase.assertEqual(realm.objects('DateObject')[0].dateCol, 1000);
+        realm.close();
+
+        TestCase.assertThrows(() => new Realm({schema: schema, dateRepresentation: 'seconds'}));
+    },
+
+    testDateStrings: function() {
+        const schema = [{name: 'DateObject', properties: {dateCol: 'date'}}];
+        const realm = new Realm({schema: schema, dateRepresentation: 'secondsNanoseconds'});
+        realm.write(function() {
+            realm.create('DateObject', {dateCol: '2017-12-07T20:16:03.837Z'});
+            realm.create('DateObject', {dateCol: '2017-12-07T21:16:03.123456789+01:00'});
+            realm.create('DateObject', {dateCol: '1969-12-31T23:59:59.5Z'});
+            realm.create('DateObject', {dateCol: '2017-12-07'});
+            realm.create('DateObject', {dateCol: new Date(1000).toString()});
+            TestCase.assertThrowsContaining(() => realm.create('DateObject', {dateCol: 'not a date'}), 'Invalid date');
+            TestCase.assertThrowsContaining(() => realm.create('DateObject', {dateCol: new Date(NaN)}), 'Invalid date');
+        });
+
+        const objects = realm.objects('DateObject');
+        TestCase.assertArraysEqual(objects[0].dateCol, [1512677763, 837000000]);
+        TestCase.assertArraysEqual(objects[1].dateCol, [1512677763, 123456789]);
+        TestCase.assertArraysEqual(objects[2].dateCol, [0, -500000000]);
+        TestCase.assertArraysEqual(objects[3].dateCol, [1512604800, 0]);
+        TestCase.assertArraysEqual(objects[4].dateCol, [1, 0]);
+
+        TestCase.assertEqual(objects.filtered('dateCol > $0', '2017-12-07T20:16:03.123456788Z').length, 2);
+        TestCase.assertEqual(objects.filtered('dateCol == $0', '2017-12-07T20:16:03.123456789Z').length, 1);
+    },
+
     testDateResolution: function() {
         const dateObjectSchema = {
             name: 'DateObject',
@@ -473,5 +638,66 @@ module.exports = {
         TestCase.assertTrue(new Date('2017-12-07T20:16:03.837Z').toISOString() === objects[0].dateCol.toISOString())
 
         realm.close()
+    },
+
+    testToJSON: function() {
+        const nodeSchema = {
+            name: 'Node',
+            primaryKey: 'id',
+            properties: {
+                id: 'int',
+                tags: 'string[]',
+                next: 'Node',
+                children: 'Node[]',
+                item: 'TestObject',
+            }
+        };
+        const realm = new Realm({schema: [nodeSchema, schemas.TestObject]});
+
+        let a, b;
+        realm.write(() => {
+            a = realm.create('Node', {id: 1, tags: ['x', 'y'], item: {doubleCol: 1.5}});
+            b = realm.create('Node', {id: 2, next: a, children: [a]});
+            realm.create('Node', {id: 3, next: b, children: [a, b]});
+            a.next = b;
+        });
+
+        // cycles become primary keys
+        TestCase.assertEqual(JSON.stringify(a.toJSON()),
+            '{"id":1,"tags":["x","y"],"next":{"id":2,"tags":[],"next":1,"children":[1],"item":null},"children":[],"item":{"doubleCol":1.5}}');
+        TestCase.assertEqual(JSON.stringify(a), JSON.stringify(a.toJSON()));
+
+        TestCase.assertEqual(JSON.stringify(b.toJSON({depth: 0})),
+            '{"id":2,"tags":[],"next":1,"children":[1],"item":null}');
+
+        // links without a primary key are null when not followed
+        TestCase.assertEqual(a.toJSON({depth: 0}).item, null);
+
+        TestCase.assertEqual(JSON.stringify(realm.objectForPrimaryKey('Node', 3).toJSON({include: ['next.next']})),
+            '{"id":3,"tags":[],"next":{"id":2,"tags":[],"next":{"id":1,"tags":["x","y"],"next":2,"children":[],"item":null},"children":[1],"item":null},"children":[1,2],"item":null}');
+
+        const results = realm.objects('Node').sorted('id');
+        const json = results.toJSON({depth: 1});
+        TestCase.assertEqual(json.length, 3);
+        TestCase.assertEqual(json[2].next.id, 2);
+        TestCase.assertEqual(json[2].next.next, 1);
+        TestCase.assertEqual(JSON.stringify(results), JSON.stringify(results.toJSON()));
+
+        // An object converted with a cycle cut isn't reused where the cycle isn't on the path.
+        const full = results.toJSON();
+        TestCase.assertEqual(full[0].next.next, 1);
+        TestCase.assertEqual(full[1].next.id, 1);
+        TestCase.assertEqual(full[2].next.next.id, 1);
+        TestCase.assertEqual(full[2].next.next.next, 2);
+        TestCase.assertEqual(JSON.stringify(full[2].next), JSON.stringify(full[1]));
+        TestCase.assertArraysEqual(a.tags.toJSON(), ['x', 'y']);
+
+        TestCase.assertThrowsContaining(() => a.toJSON({include: ['tags']}),
+                                        "Invalid key path 'tags' in 'include': 'Node.tags' is not a link.");
+        TestCase.assertThrowsContaining(() => a.toJSON({include: ['next.foo']}),
+                                        "Invalid key path 'next.foo' in 'include': 'Node.foo' is not a link.");
+        TestCase.assertThrows(() => a.toJSON({depth: -1}));
+
+        realm.close();
     }
 };
@@ -670,6 +670,180 @@ module.exports = {
         TestCase.assertEqual(realm.objects('IntPrimaryObject').length, 0);
     },
 
+    testDeleteWhere: function() {
+        const realm = new Realm({schema: [schemas.TestObject, schemas.IntPrimary]});
+
+        realm.write(() => {
+            for (let i = 0; i < 10; i++) {
+                realm.create('TestObject', {doubleCol: i});
+                realm.create('IntPrimaryObject', {primaryCol: i, valueCol: 'value' + i});
+            }
+        });
+
+        TestCase.assertThrowsContaining(() => realm.deleteWhere('TestObject', 'doubleCol < 5'),
+                                        "Can only delete objects within a transaction.");
+
+        realm.write(() => {
+            TestCase.assertEqual(realm.deleteWhere('TestObject', 'doubleCol < $0', 5), 5);
+            TestCase.assertEqual(realm.deleteWhere('TestObject', 'doubleCol > $0 AND doubleCol < $1', 100, 200), 0);
+            TestCase.assertEqual(realm.deleteWhere('IntPrimaryObject', 'valueCol ENDSWITH "1" OR primaryCol == $0', 9), 2);
+
+            TestCase.assertThrows(() => realm.deleteWhere('TestObject'));
+            TestCase.assertThrows(() => realm.deleteWhere('TestObject', 'invalidCol == 1'));
+            TestCase.assertThrows(() => realm.deleteWhere('InvalidClass', 'doubleCol == 1'));
+        });
+
+        TestCase.assertEqual(realm.objects('TestObject').length, 5);
+        TestCase.assertEqual(realm.objects('TestObject').filtered('doubleCol < 5').length, 0);
+        TestCase.assertEqual(realm.objects('IntPrimaryObject').length, 8);
+        TestCase.assertEqual(realm.objectForPrimaryKey('IntPrimaryObject', 1), undefined);
+    },
+
+    testRealmCount: function() {
+        const realm = new Realm({schema: [schemas.TestObject, schemas.IntPrimary]});
+
+        TestCase.assertEqual(realm.count('TestObject'), 0);
+        TestCase.assertFalse(realm.exists('TestObject'));
+
+        realm.write(() => {
+            for (let i = 0; i < 10; i++) {
+                realm.create('TestObject', {doubleCol: i});
+                realm.create('IntPrimaryObject', {primaryCol: i, valueCol: 'value' + i});
+            }
+        });
+
+        TestCase.assertEqual(realm.count('TestObject'), 10);
+        TestCase.assertEqual(realm.count('TestObject', 'doubleCol < $0', 5), 5);
+        TestCase.assertEqual(realm.count('TestObject', 'doubleCol > $0 AND doubleCol < $1', 100, 200), 0);
+        TestCase.assertEqual(realm.count('IntPrimaryObject', 'valueCol ENDSWITH "1" OR primaryCol == $0', 9), 2);
+
+        TestCase.assertTrue(realm.exists('TestObject'));
+        TestCase.assertTrue(realm.exists('TestObject', 'doubleCol >= $0', 9));
+        TestCase.assertFalse(realm.exists('TestObject', 'doubleCol > $0', 9));
+
+        TestCase.assertThrows(() => realm.count());
+        TestCase.assertThrows(() => realm.count('TestObject', 'invalidCol == 1'));
+        TestCase.assertThrows(() => realm.exists('InvalidClass'));
+
+        realm.close();
+        TestCase.assertThrows(() => realm.count('TestObject'));
+    },
+
+    testRealmViews: function() {
+        const realm = new Realm({schema: [schemas.TestObject]});
+        realm.write(() => {
+            for (let i = 0; i < 10; i++) {
+                realm.create('TestObject', {doubleCol: i});
+            }
+        });
+
+        const values = (results) => results.map((object) => object.doubleCol);
+
+        const large = realm.defineView('large', 'TestObject', 'doubleCol >= 7', ['doubleCol', true]);
+        TestCase.assertArraysEqual(values(large), [9, 8, 7]);
+        TestCase.assertEqual(realm.view('large'), large);
+        TestCase.assertArraysEqual(values(realm.defineView('all', schemas.TestObject)), [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]);
+        TestCase.assertArraysEqual(values(realm.defineView('sorted', 'TestObject', null, 'doubleCol')).slice(0, 2), [0, 1]);
+
+        // views are live
+        realm.write(() => {
+            realm.create('TestObject', {doubleCol: 20});
+            realm.delete(realm.objects('TestObject').filtered('doubleCol == 8'));
+        });
+        TestCase.assertArraysEqual(values(realm.view('large')), [20, 9, 7]);
+
+        // defining a view again replaces it
+        realm.defineView('large', 'TestObject', 'doubleCol >= 9');
+        TestCase.assertEqual(realm.view('large').length, 2);
+        TestCase.assertNotEqual(realm.view('large'), large);
+
+        TestCase.assertThrowsContaining(() => realm.view('missing'), "No view named 'missing' has been defined.");
+        TestCase.assertThrows(() => realm.defineView('invalid', 'TestObject', 'invalidCol == 1'));
+        TestCase.assertThrows(() => realm.defineView('invalid', 'InvalidClass'));
+        TestCase.assertThrows(() => realm.defineView('invalid', 'TestObject', 'doubleCol == $0'));
+
+        // removing a view, or closing the Realm, releases it
+        realm.removeView('large');
+        TestCase.assertThrowsContaining(() => realm.view('large'), "No view named 'large' has been defined.");
+        realm.removeView('large');
+        realm.close();
+        TestCase.assertThrows(() => realm.view('all'));
+
+        const reopened = new Realm({schema: [schemas.TestObject]});
+        TestCase.assertThrowsContaining(() => reopened.view('all'), "No view named 'all' has been defined.");
+        reopened.close();
+    },
+
+    testRealmThreadSafeReferences: function() {
+        if (typeof navigator !== 'undefined' && /Chrome/.test(navigator.userAgent)) { // eslint-disable-line no-undef
+            // thread safe references are not supported in Chrome debugging mode
+            return;
+        }
+
+        const realm = new Realm({schema: [schemas.TestObject, schemas.LinkTypes]});
+        let linkObject;
+        realm.write(() => {
+            linkObject = realm.create('LinkTypesObject', {arrayCol: [{doubleCol: 1}, {doubleCol: 2}]});
+            realm.create('TestObject', {doubleCol: 3});
+        });
+
+        const results = realm.objects('TestObject').filtered('doubleCol >= 2').sorted('doubleCol');
+        const resultsReference = realm.obtainThreadSafeReference(results);
+        TestCase.assertTrue(resultsReference instanceof Realm.ThreadSafeReference);
+        TestCase.assertEqual(resultsReference.type, 'results');
+        TestCase.assertEqual(resultsReference.objectType, 'TestObject');
+        TestCase.assertFalse(resultsReference.isResolved);
+
+        const objectReference = realm.obtainThreadSafeReference(linkObject);
+        const listReference = realm.obtainThreadSafeReference(linkObject.arrayCol);
+        TestCase.assertEqual(objectReference.type, 'object');
+        TestCase.assertEqual(listReference.type, 'list');
+        TestCase.assertNotEqual(objectReference.id, listReference.id);
+
+        // objects created after the reference was obtained are in the resolved results, which stay live
+        realm.write(() => realm.create('TestObject', {doubleCol: 4}));
+        const resolvedResults = realm.resolveThreadSafeReference(resultsReference.id);
+        TestCase.assertTrue(resolvedResults instanceof Realm.Results);
+        TestCase.assertArraysEqual(resolvedResults.map((object) => object.doubleCol), [2, 3, 4]);
+        TestCase.assertTrue(resultsReference.isResolved);
+
+        const resolvedList = realm.resolveThreadSafeReference(listReference);
+        TestCase.assertTrue(resolvedList instanceof Realm.List);
+        TestCase.assertEqual(resolvedList.length, 2);
+        TestCase.assertEqual(realm.resolveThreadSafeReference(objectReference).arrayCol[1].doubleCol, 2);
+
+        TestCase.assertThrowsContaining(() => realm.resolveThreadSafeReference(resultsReference),
+                                        'does not exist or has already been resolved');
+        TestCase.assertThrowsContaining(() => realm.obtainThreadSafeReference({}),
+                                        'can only be obtained for Realm objects, Lists and Results');
+
+        const reference = realm.obtainThreadSafeReference(results);
+        realm.write(() => {
+            TestCase.assertThrowsContaining(() => realm.resolveThreadSafeReference(reference),
+                                            'during a write transaction');
+        });
+
+        const otherRealm = new Realm({path: 'other.realm', schema: [schemas.TestObject]});
+        TestCase.assertThrowsContaining(() => otherRealm.resolveThreadSafeReference(reference),
+                                        'cannot be resolved by the Realm at');
+        TestCase.assertThrowsContaining(() => otherRealm.obtainThreadSafeReference(results),
+                                        'of another Realm');
+        TestCase.assertEqual(realm.resolveThreadSafeReference(reference).length, 3);
+        otherRealm.close();
+
+        // references which won't be resolved are released explicitly, or when their Realm is closed
+        const released = realm.obtainThreadSafeReference(results);
+        released.release();
+        TestCase.assertTrue(released.isResolved);
+        TestCase.assertThrowsContaining(() => realm.resolveThreadSafeReference(released),
+                                        'does not exist or has already been resolved');
+        released.release();
+
+        const unresolved = realm.obtainThreadSafeReference(results);
+        realm.close();
+        TestCase.assertTrue(unresolved.isResolved);
+    },
+
     testRealmObjects: function() {
         const realm = new Realm({schema: [schemas.PersonObject, schemas.DefaultValues, schemas.TestObject]});
 
@@ -749,6 +923,141 @@ module.exports = {
                                         "Object type 'InvalidClass' not found in schema.");
     },
 
+    testRealmCreateUpsertModified: function() {
+        const realm = new Realm({schema: [schemas.AllPrimaryTypes, schemas.TestObject, schemas.StringPrimary,
+                                          {name: 'Parent', primaryKey: 'id', properties: {id: 'int', child: 'StringPrimaryObject', values: 'int[]'}}]});
+        const values = {
+            primaryCol: '0',
+            boolCol:    true,
+            intCol:     1,
+            floatCol:   1.5,
+            doubleCol:  1.11,
+            stringCol:  '1',
+            dateCol:    new Date(1),
+            dataCol:    new ArrayBuffer(1),
+            objectCol:  null,
+            arrayCol:   [],
+        };
+
+        realm.write(() => {
+            const obj = realm.create('AllPrimaryTypesObject', values, {update: 'modified'});
+            TestCase.assertEqual(obj.stringCol, '1');
+            realm.create('AllPrimaryTypesObject', values, {update: 'modified'});
+            TestCase.assertEqual(realm.objects('AllPrimaryTypesObject').length, 1);
+
+            realm.create('AllPrimaryTypesObject', {primaryCol: '0', stringCol: '2', intCol: 1}, {update: 'modified'});
+            TestCase.assertEqual(obj.stringCol, '2');
+            TestCase.assertEqual(obj.intCol, 1);
+            TestCase.assertEqual(obj.boolCol, true);
+
+            realm.create('AllPrimaryTypesObject', {primaryCol: '0', stringCol: '3'}, {update: 'all'});
+            TestCase.assertEqual(obj.stringCol, '3');
+            realm.create('AllPrimaryTypesObject', {primaryCol: '0', stringCol: '4'}, {update: true});
+            TestCase.assertEqual(obj.stringCol, '4');
+
+            const parent = realm.create('Parent', {id: 1, child: {primaryCol: 'a', valueCol: 1}, values: [1, 2, 3]}, {update: 'modified'});
+            realm.create('Parent', {id: 1, child: {primaryCol: 'a', valueCol: 2}, values: [1, 2]}, {update: 'modified'});
+            TestCase.assertEqual(parent.child.valueCol, 2);
+            TestCase.assertArraysEqual(parent.values, [1, 2]);
+            TestCase.assertEqual(realm.objects('StringPrimaryObject').length, 1);
+
+            TestCase.assertThrows(() => realm.create('AllPrimaryTypesObject', values, {update: 'some'}));
+            TestCase.assertThrows(() => realm.create('AllPrimaryTypesObject', values, {update: 1}));
+        });
+
+        // Even when nothing would be written.
+        TestCase.assertThrows(() => realm.create('AllPrimaryTypesObject', {primaryCol: '0', stringCol: '4'}, {update: 'modified'}));
+        TestCase.assertThrows(() => realm.create('AllPrimaryTypesObject', {primaryCol: '1', stringCol: '4'}, {update: 'modified'}));
+    },
+
+    testRealmCreateUpsertModifiedNotifications: function() {
+        const realm = new Realm({schema: [schemas.StringPrimary]});
+        realm.write(() => {
+            realm.create('StringPrimaryObject', {primaryCol: '0', valueCol: 0});
+            realm.create('StringPrimaryObject', {primaryCol: '1', valueCol: 1});
+        });
+
+        let resolve = () => {};
+        let first = true;
+        realm.objects('StringPrimaryObject').sorted('primaryCol').addListener((objects, changes) => {
+            if (first) {
+                first = false;
+                realm.write(() => {
+                    realm.create('StringPrimaryObject', {primaryCol: '0', valueCol: 0}, {update: 'modified'});
+                    realm.create('StringPrimaryObject', {primaryCol: '1', valueCol: 2}, {update: 'modified'});
+                });
+                return;
+            }
+            TestCase.assertArraysEqual(changes.modifications, [1]);
+            resolve();
+        });
+
+        return new Promise((r) => resolve = r);
+    },
+
+    testRealmCreateUpsertModifiedListsAndNaN: function() {
+        const realm = new Realm({schema: [schemas.StringPrimary,
+                                          {name: 'Holder', primaryKey: 'id', properties: {id: 'int', children: 'StringPrimaryObject[]', ratio: 'double'}}]});
+        const holders = [
+            {id: 0, children: [{primaryCol: 'a', valueCol: 1}, {primaryCol: 'b', valueCol: 2}], ratio: NaN},
+            {id: 1, children: [], ratio: 1},
+        ];
+        realm.write(() => holders.forEach((holder) => realm.create('Holder', holder)));
+
+        let resolve = () => {};
+        let first = true;
+        realm.objects('Holder').sorted('id').addListener((objects, changes) => {
+            if (first) {
+                first = false;
+                // The list of the first holder links to the same objects, which are unchanged, and NaN
+                // is the same as NaN, so only the second holder is modified.
+                realm.write(() => {
+                    realm.create('Holder', holders[0], {update: 'modified'});
+                    realm.create('Holder', {id: 1, ratio: 2}, {update: 'modified'});
+                });
+                return;
+            }
+            TestCase.assertArraysEqual(changes.modifications, [1]);
+            TestCase.assertEqual(realm.objects('StringPrimaryObject').length, 2);
+            resolve();
+        });
+
+        return new Promise((r) => resolve = r);
+    },
+
+    testRealmObjectsForPrimaryKeys: function() {
+        const realm = new Realm({schema: [schemas.IntPrimary, schemas.StringPrimary, schemas.TestObject]});
+
+        realm.write(() => {
+            for (let i = 0; i < 100; i++) {
+                realm.create('IntPrimaryObject', {primaryCol: i, valueCol: 'val' + i});
+                realm.create('StringPrimaryObject', {primaryCol: 'val' + i, valueCol: i});
+            }
+            realm.create('TestObject', {doubleCol: 0});
+        });
+
+        let objects = realm.objectsForPrimaryKeys('IntPrimaryObject', [5, -1, 99, 5]);
+        TestCase.assertEqual(objects.length, 4);
+        TestCase.assertEqual(objects[0].valueCol, 'val5');
+        TestCase.assertEqual(objects[1], undefined);
+        TestCase.assertEqual(objects[2].valueCol, 'val99');
+        TestCase.assertTrue(objects[3].isValid());
+        TestCase.assertEqual(objects[3].valueCol, 'val5');
+
+        objects = realm.objectsForPrimaryKeys('StringPrimaryObject', ['val42', 'invalid']);
+        TestCase.assertEqual(objects[0].valueCol, 42);
+        TestCase.assertEqual(objects[1], undefined);
+
+        TestCase.assertEqual(realm.objectsForPrimaryKeys('IntPrimaryObject', []).length, 0);
+
+        TestCase.assertThrowsContaining(() => realm.objectsForPrimaryKeys('TestObject', [0]),
+                                        "'TestObject' does not have a primary key defined");
+        TestCase.assertThrowsContaining(() => realm.objectsForPrimaryKeys('IntPrimaryObject', [1, null]),
+                                        "Invalid null value for non-nullable primary key.");
+        TestCase.assertThrows(() => realm.objectsForPrimaryKeys('IntPrimaryObject', 1));
+        TestCase.assertThrows(() => realm.objectsForPrimaryKeys('IntPrimaryObject'));
+    },
+
     testNotifications: function() {
         const realm = new Realm({schema: []});
         let notificationCount = 0;
@@ -188,6 +188,52 @@ module.exports = {
         });
     },
 
+    testResultsFilteredParallel: function() {
+        var realm = new Realm({schema: [schemas.TestObject]});
+        var objects = realm.objects('TestObject');
+
+        realm.write(function() {
+            for (var i = 0; i < 100; i++) {
+                realm.create('TestObject', {doubleCol: i % 10 == 0 ? 100 - i : i});
+            }
+        });
+
+        var sequential = objects.filtered('doubleCol >= $0', 50);
+        var parallel = objects.filtered('doubleCol >= $0', 50, {parallel: 4});
+        TestCase.assertEqual(parallel.length, sequential.length);
+        for (var i = 0; i < sequential.length; i++) {
+            TestCase.assertEqual(parallel[i].doubleCol, sequential[i].doubleCol);
+        }
+        TestCase.assertEqual(objects.filtered('doubleCol < 0', {parallel: 4}).length, 0);
+        TestCase.assertEqual(objects.filtered('doubleCol >= 50', {parallel: 1000}).length, sequential.length);
+
+        // The results are a snapshot.
+        var length = parallel.length;
+        realm.write(function() {
+            realm.create('TestObject', {doubleCol: 1000});
+        });
+        TestCase.assertEqual(parallel.length, length);
+        TestCase.assertEqual(sequential.length, length + 1);
+
+        realm.write(function() {
+            TestCase.assertEqual(objects.filtered('doubleCol >= 50', {parallel: 4}).length, length + 1);
+        });
+
+        TestCase.assertThrowsContaining(function() {
+            sequential.filtered('doubleCol > 60', {parallel: 4});
+        }, "can only be used to filter all of the objects of a type");
+        TestCase.assertThrowsContaining(function() {
+            objects.filtered('doubleCol > 60', {parallel: 0});
+        }, "parallel must be a positive integer");
+        TestCase.assertThrowsContaining(function() {
+            objects.filtered('doubleCol > 60', {parallel: 1.5});
+        }, "parallel must be a positive integer");
+
+        // The threads close their instances of the Realm when the query is done, so it can be compacted.
+        TestCase.assertEqual(objects.filtered('doubleCol >= 50', {parallel: 4}).length, length + 1);
+        TestCase.assertTrue(realm.compact());
+    },
+
     testResultsSorted: function() {
         var realm = new Realm({schema: [schemas.IntPrimary]});
         var objects = realm.objects('IntPrimaryObject');
@@ -256,6 +302,105 @@ module.exports = {
         });
     },
 
+    testResultsDistinct: function() {
+        var realm = new Realm({schema: [schemas.IntPrimary]});
+        var objects = realm.objects('IntPrimaryObject');
+
+        realm.write(function() {
+            realm.create('IntPrimaryObject', {primaryCol: 2, valueCol: 'a'});
+            realm.create('IntPrimaryObject', {primaryCol: 3, valueCol: 'a'});
+            realm.create('IntPrimaryObject', {primaryCol: 1, valueCol: 'b'});
+            realm.create('IntPrimaryObject', {primaryCol: 4, valueCol: 'c'});
+            realm.create('IntPrimaryObject', {primaryCol: 0, valueCol: 'c'});
+        });
+
+        var primaries = function(results) {
+            return results.map(function(object) {
+                return object.primaryCol;
+            });
+        };
+
+        var distinct = objects.distinct('valueCol');
+        TestCase.assertArraysEqual(primaries(distinct), [2, 1, 4]);
+        TestCase.assertArraysEqual(primaries(objects.distinct(['valueCol', 'primaryCol'])), [2, 3, 1, 4, 0]);
+        TestCase.assertArraysEqual(primaries(objects.sorted('primaryCol').distinct('valueCol')), [0, 1, 2]);
+        TestCase.assertArraysEqual(primaries(distinct.filtered('primaryCol > 1')), [2, 4]);
+
+        // the results are live
+        realm.write(function() {
+            realm.create('IntPrimaryObject', {primaryCol: 5, valueCol: 'd'});
+            realm.create('IntPrimaryObject', {primaryCol: 6, valueCol: 'd'});
+        });
+        TestCase.assertArraysEqual(primaries(distinct), [2, 1, 4, 5]);
+
+        TestCase.assertThrows(function() {
+            objects.distinct();
+        });
+        TestCase.assertThrows(function() {
+            objects.distinct('fish');
+        });
+        TestCase.assertThrows(function() {
+            objects.distinct(['valueCol'], true);
+        });
+    },
+
+    testResultsSearch: function() {
+        var Article = {
+            name: 'Article',
+            properties: {
+                id: 'int',
+                title: 'string',
+                body: {type: 'string', optional: true, fullTextIndexed: true},
+            }
+        };
+        var realm = new Realm({schema: [Article]});
+        var articles = realm.objects('Article');
+        realm.write(function() {
+            realm.create('Article', {id: 0, title: 'a', body: 'The quick brown fox'});
+            realm.create('Article', {id: 1, title: 'b', body: 'Quick, quick! Thinking fast.'});
+            realm.create('Article', {id: 2, title: 'c', body: 'Brown bread'});
+            realm.create('Article', {id: 3, title: 'd', body: 'Foxes and fox-hounds'});
+            realm.create('Article', {id: 4, title: 'e', body: null});
+        });
+
+        var ids = function(objects) {
+            return objects.map(function(object) {
+                return object.id;
+            });
+        };
+
+        TestCase.assertArraysEqual(ids(articles.search('body', 'QUICK')), [1, 0]);
+        TestCase.assertArraysEqual(ids(articles.search('body', 'brown fox')), [0]);
+        TestCase.assertArraysEqual(ids(articles.search('body', ['brown', 'fox'])), [0]);
+        TestCase.assertArraysEqual(ids(articles.search('body', 'fox*')), [3, 0]);
+        TestCase.assertArraysEqual(ids(articles.search('body', 'cat')), []);
+        TestCase.assertArraysEqual(ids(articles.filtered('id > 0').search('body', 'quick')), [1]);
+
+        // the index follows changes
+        realm.write(function() {
+            realm.create('Article', {id: 5, title: 'f', body: 'A quick note'});
+            articles.filtered('id == 1')[0].body = 'Slow';
+        });
+        TestCase.assertArraysEqual(ids(articles.search('body', 'quick')), [0, 5]);
+        realm.write(function() {
+            realm.delete(articles.filtered('id == 0'));
+        });
+        TestCase.assertArraysEqual(ids(articles.search('body', 'quick')), [5]);
+
+        // the Realm can be searched when opened without a schema, and properties which aren't
+        // declared as full-text indexed are indexed by their first search
+        var reopened = new Realm({path: realm.path});
+        TestCase.assertArraysEqual(ids(reopened.objects('Article').search('body', 'bread')), [2]);
+        TestCase.assertArraysEqual(ids(reopened.objects('Article').search('title', 'f')), [5]);
+
+        TestCase.assertThrowsContaining(function() {
+            articles.search('id', '1');
+        }, "Property 'Article.id' of type 'int' cannot be searched.");
+        TestCase.assertThrowsContaining(function() {
+            new Realm({path: 'search.realm', schema: [{name: 'Tags', properties: {tags: {type: 'string[]', fullTextIndexed: true}}}]});
+        }, "Property 'Tags.tags' of type 'string[]' cannot be full-text indexed.");
+    },
+
     testResultsSortedAllTypes: function() {
         var realm = new Realm({schema: [schemas.BasicTypes]});
         var objects = realm.objects('BasicTypesObject');
@@ -546,6 +691,179 @@ module.exports = {
         TestCase.assertUndefined(emptyResults.max('dateCol'));
     },
 
+    testResultsAggregate: function() {
+        var realm = new Realm({ schema: [schemas.NullableBasicTypes] });
+        const N = 50;
+        realm.write(() => {
+            for(var i = 0; i < N; i++) {
+                realm.create('NullableBasicTypesObject', {
+                    intCol: i+1,
+                    floatCol: i+1,
+                    doubleCol: i+1,
+                    dateCol: new Date(i+1)
+                });
+            }
+            realm.create('NullableBasicTypesObject', {});
+        });
+
+        var results = realm.objects('NullableBasicTypesObject');
+        var aggregates = results.aggregate({
+            count: true,
+            min: ['intCol', 'dateCol'],
+            max: ['intCol', 'dateCol'],
+            sum: ['intCol', 'floatCol', 'doubleCol'],
+            avg: 'doubleCol',
+        });
+
+        TestCase.assertEqual(aggregates.count, N + 1);
+        TestCase.assertEqual(aggregates.min.intCol, 1);
+        TestCase.assertEqual(aggregates.max.intCol, N);
+        TestCase.assertEqual(aggregates.min.dateCol.getTime(), 1);
+        TestCase.assertEqual(aggregates.max.dateCol.getTime(), N);
+        ['intCol', 'floatCol', 'doubleCol'].forEach(colName => {
+            TestCase.assertEqual(aggregates.sum[colName], results.sum(colName));
+        });
+        TestCase.assertEqual(aggregates.avg.doubleCol, (N+1)/2);
+
+        // only the requested aggregates are computed
+        TestCase.assertEqual(Object.keys(results.aggregate({sum: 'intCol'})).join(), 'sum');
+
+        var empty = results.filtered('intCol < 0').aggregate({count: true, min: 'intCol', sum: 'intCol', avg: 'intCol'});
+        TestCase.assertEqual(empty.count, 0);
+        TestCase.assertUndefined(empty.min.intCol);
+        TestCase.assertEqual(empty.sum.intCol, 0);
+        TestCase.assertUndefined(empty.avg.intCol);
+
+        TestCase.assertThrowsContaining(() => results.aggregate({sum: 'dateCol'}),
+                                        "Cannot compute sum of property 'dateCol'");
+        TestCase.assertThrowsContaining(() => results.aggregate({min: 'stringCol'}),
+                                        "Cannot compute min of property 'stringCol'");
+        TestCase.assertThrowsContaining(() => results.aggregate({avg: 'foo'}),
+                                        "Property 'foo' does not exist");
+
+        // NaN is left out of minima and maxima, wherever it is in the results
+        realm.write(() => {
+            realm.create('NullableBasicTypesObject', {doubleCol: NaN});
+        });
+        [results.sorted('intCol'), results.sorted('intCol', true)].forEach(sorted => {
+            var extremes = sorted.aggregate({min: 'doubleCol', max: 'doubleCol'});
+            TestCase.assertEqual(extremes.min.doubleCol, 1);
+            TestCase.assertEqual(extremes.max.doubleCol, N);
+        });
+    },
+
+    testResultsGroupBy: function() {
+        var realm = new Realm({ schema: [schemas.NullableBasicTypes] });
+        realm.write(() => {
+            for(var i = 0; i < 30; i++) {
+                realm.create('NullableBasicTypesObject', {
+                    intCol: i,
+                    stringCol: ['a', 'b', 'c'][i % 3],
+                    boolCol: i % 2 == 0,
+                    doubleCol: i < 10 ? null : i,
+                });
+            }
+        });
+
+        var results = realm.objects('NullableBasicTypesObject');
+        var groups = results.groupBy('stringCol').aggregate({count: true, sum: 'intCol', max: 'intCol'});
+        TestCase.assertEqual(groups.length, 3);
+        TestCase.assertArraysEqual(groups.map(group => group.key), ['a', 'b', 'c']);
+        groups.forEach((group, index) => {
+            TestCase.assertEqual(group.count, 10);
+            TestCase.assertEqual(group.sum.intCol, 135 + 10 * index);
+            TestCase.assertEqual(group.max.intCol, 27 + index);
+        });
+
+        // groups are ordered by first appearance, and null is a group of its own
+        groups = results.sorted('intCol', true).groupBy('doubleCol').aggregate({count: true});
+        TestCase.assertEqual(groups.length, 21);
+        TestCase.assertEqual(groups[0].key, 29);
+        TestCase.assertEqual(groups[20].key, null);
+        TestCase.assertEqual(groups[20].count, 10);
+
+        groups = results.filtered('intCol < 10').groupBy('boolCol').aggregate({avg: 'intCol'});
+        TestCase.assertEqual(groups.length, 2);
+        TestCase.assertEqual(groups[0].key, true);
+        TestCase.assertEqual(groups[0].avg.intCol, 4);
+        TestCase.assertEqual(groups[1].avg.intCol, 5);
+
+        TestCase.assertEqual(results.filtered('intCol < 0').groupBy('stringCol').aggregate({count: true}).length, 0);
+
+        TestCase.assertThrowsContaining(() => results.groupBy('foo').aggregate({count: true}),
+                                        "Property 'foo' does not exist");
+    },
+
+    testResultsLiveAggregate: function() {
+        if (typeof navigator !== 'undefined' && /Chrome/.test(navigator.userAgent)) { // eslint-disable-line no-undef
+            // FIXME: async callbacks do not work correctly in Chrome debugging mode
+            return Promise.resolve();
+        }
+
+        var realm = new Realm({ schema: [schemas.NullableBasicTypes] });
+        realm.write(() => {
+            for(var i = 1; i <= 10; i++) {
+                realm.create('NullableBasicTypesObject', {intCol: i, doubleCol: i / 2});
+            }
+        });
+
+        var results = realm.objects('NullableBasicTypesObject').filtered('intCol > 2');
+        var onChange = () => {};
+        var aggregates = results.liveAggregate({count: true, sum: ['intCol', 'doubleCol'], min: 'intCol', max: 'intCol'},
+                                               aggregates => onChange(aggregates));
+        TestCase.assertEqual(aggregates.count, 8);
+        TestCase.assertEqual(aggregates.sum.intCol, 52);
+        TestCase.assertEqual(aggregates.sum.doubleCol, 26);
+        TestCase.assertEqual(aggregates.min.intCol, 3);
+        TestCase.assertEqual(aggregates.max.intCol, 10);
+
+        TestCase.assertThrowsContaining(() => results.liveAggregate({sum: 'foo'}, () => {}),
+                                        "Property 'foo' does not exist");
+
+        return new Promise((resolve, reject) => {
+            var step = 0;
+            onChange = (live) => {
+                try {
+                    TestCase.assertEqual(live, aggregates);
+                    switch (step++) {
+                        case 0:
+                            TestCase.assertEqual(aggregates.count, 8);
+                            realm.write(() => {
+                                // an insertion, a deletion of the minimum, a modification of the maximum
+                                // and an object which stops matching the query
+                                realm.create('NullableBasicTypesObject', {intCol: 20, doubleCol: 1});
+                                realm.delete(results.filtered('intCol == 3'));
+                                results.filtered('intCol == 10')[0].intCol = 15;
+                                results.filtered('intCol == 4')[0].intCol = 1;
+                            });
+                            break;
+                        case 1:
+                            TestCase.assertEqual(aggregates.count, 7);
+                            TestCase.assertEqual(aggregates.sum.intCol, results.sum('intCol'));
+                            TestCase.assertEqual(aggregates.sum.intCol, 70);
+                            TestCase.assertEqual(aggregates.sum.doubleCol, results.sum('doubleCol'));
+                            TestCase.assertEqual(aggregates.min.intCol, 5);
+                            TestCase.assertEqual(aggregates.max.intCol, 20);
+                            realm.write(() => results.filtered('intCol == 5')[0].doubleCol = NaN);
+                            break;
+                        case 2:
+                            TestCase.assertTrue(isNaN(aggregates.sum.doubleCol));
+                            realm.write(() => results.filtered('intCol == 5')[0].doubleCol = 2.5);
+                            break;
+                        default:
+                            // the sum recovers once the NaN is gone
+                            TestCase.assertEqual(aggregates.sum.doubleCol, results.sum('doubleCol'));
+                            results.removeAllListeners();
+                            resolve();
+                    }
+                }
+                catch (e) {
+                    reject(e);
+                }
+            };
+        });
+    },
+
     testResultsAggregateFunctionsUnsupported: function() {
         var realm = new Realm({ schema: [schemas.NullableBasicTypes] });
         realm.write(() => {